@@ -5,7 +5,10 @@
 #ifndef INCLUDE_V8_JSON_H_
 #define INCLUDE_V8_JSON_H_
 
+#include <stddef.h>
+
 #include "v8-local-handle.h"  // NOLINT(build/include_directory)
+#include "v8-maybe.h"         // NOLINT(build/include_directory)
 #include "v8config.h"         // NOLINT(build/include_directory)
 
 namespace v8 {
@@ -40,6 +43,37 @@ class V8_EXPORT JSON {
   static V8_WARN_UNUSED_RESULT MaybeLocal<String> Stringify(
       Local<Context> context, Local<Value> json_object,
       Local<String> gap = Local<String>());
+
+  /**
+   * Receives the output of StringifyToUtf8Buffer.
+   *
+   * Append is called while garbage collection is disallowed. It must not call
+   * back into V8 or do anything else that may allocate on the V8 heap.
+   */
+  class V8_EXPORT Utf8Sink {
+   public:
+    virtual ~Utf8Sink() = default;
+
+    /**
+     * Appends |length| bytes of UTF-8 to the output. Chunks never end in the
+     * middle of a multi-byte sequence. |data| is only valid during the call,
+     * so the sink has to copy the bytes it wants to keep.
+     */
+    virtual void Append(const char* data, size_t length) = 0;
+  };
+
+  /**
+   * Like Stringify, but writes the result as UTF-8 to |sink| instead of
+   * returning a String, so that the embedder does not have to transcode it
+   * or compute its UTF-8 length first. No String is created for the result.
+   *
+   * \param json_object The JSON-serializable object to stringify.
+   * \param sink The sink that receives the UTF-8 output.
+   * \return Just(true) if successfully stringified.
+   */
+  static V8_WARN_UNUSED_RESULT Maybe<bool> StringifyToUtf8Buffer(
+      Local<Context> context, Local<Value> json_object, Utf8Sink* sink,
+      Local<String> gap = Local<String>());
 };
 
 }  // namespace v8
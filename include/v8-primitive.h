@@ -479,6 +479,24 @@ class V8_EXPORT String : public Name {
   static V8_WARN_UNUSED_RESULT MaybeLocal<String> NewExternalOneByte(
       Isolate* isolate, ExternalOneByteStringResource* resource);
 
+  /**
+   * Creates a new string with the UTF-8 contents of the file at |path|. If
+   * the contents are ASCII, the file is mapped into memory and the result is
+   * an external string that reads its characters from the mapping. Its pages
+   * are only read when they are accessed, and V8 drops them again under memory
+   * pressure. Other contents are decoded into a regular string. Returns an
+   * empty handle if the file cannot be read or is too large for a string.
+   *
+   * Like the buffer of an external string resource, a mapped file must not be
+   * modified, truncated or replaced in place for as long as the string is
+   * alive. Dropped pages are read from the file again when they are next
+   * accessed, so the string could then change its contents, or the process
+   * could crash with SIGBUS if the file has become shorter. Copy the file into
+   * a string with NewFromUtf8 instead if it may change.
+   */
+  static V8_WARN_UNUSED_RESULT MaybeLocal<String> NewFromFile(Isolate* isolate,
+                                                              const char* path);
+
   /**
    * Associate an external string resource with this string by transforming it
    * in place so that existing references to this string in the JavaScript heap
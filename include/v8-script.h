@@ -640,6 +640,18 @@ class V8_EXPORT ScriptCompiler {
      */
     void MergeWithExistingScript();
 
+    /**
+     * Does part of the remaining main-thread work of MergeWithExistingScript
+     * for about |max_duration_in_ms| milliseconds, so that compiling the
+     * script with this task later blocks the main thread for less time. Each
+     * call makes some progress. Returns true if no such work is left. May be
+     * called any number of times, e.g. from idle tasks, after
+     * MergeWithExistingScript has completed; the Isolate must be currently
+     * entered on the calling thread. Once this has been called, the script
+     * must be compiled with this task.
+     */
+    bool ContinueMergeOnMainThread(Isolate* isolate, double max_duration_in_ms);
+
    private:
     friend class ScriptCompiler;
 
@@ -179,12 +179,53 @@ class V8_EXPORT HeapStatistics {
   size_t number_of_native_contexts() { return number_of_native_contexts_; }
   size_t number_of_detached_contexts() { return number_of_detached_contexts_; }
 
+  /**
+   * Returns the memory reserved for secondary stacks of WebAssembly stack
+   * switching, including stacks that are kept for reuse.
+   */
+  size_t total_wasm_stack_size() { return total_wasm_stack_size_; }
+
+  /**
+   * Returns the part of {total_wasm_stack_size} which belongs to unused stacks
+   * that are kept for reuse.
+   */
+  size_t pooled_wasm_stack_size() { return pooled_wasm_stack_size_; }
+
+  /**
+   * Returns how many WebAssembly stacks were taken from the pool instead of
+   * being freshly allocated.
+   */
+  size_t number_of_reused_wasm_stacks() {
+    return number_of_reused_wasm_stacks_;
+  }
+
   /**
    * Returns a 0/1 boolean, which signifies whether the V8 overwrite heap
    * garbage with a bit pattern.
    */
   size_t does_zap_garbage() { return does_zap_garbage_; }
 
+  /**
+   * Returns the off-heap memory used for compressed copies of flushed
+   * bytecode (--compress-flushed-bytecode).
+   */
+  size_t compressed_bytecode_size() { return compressed_bytecode_size_; }
+
+  /**
+   * Returns the number of functions whose bytecode was restored from a
+   * compressed copy instead of being recompiled.
+   */
+  size_t compressed_bytecode_hits() { return compressed_bytecode_hits_; }
+
+  /**
+   * Returns the number of compressed copies of flushed bytecode that were
+   * dropped without being used. Each of them costs a recompilation if the
+   * function runs again.
+   */
+  size_t compressed_bytecode_evictions() {
+    return compressed_bytecode_evictions_;
+  }
+
  private:
   size_t total_heap_size_;
   size_t total_heap_size_executable_;
@@ -200,6 +241,12 @@ class V8_EXPORT HeapStatistics {
   size_t number_of_detached_contexts_;
   size_t total_global_handles_size_;
   size_t used_global_handles_size_;
+  size_t total_wasm_stack_size_;
+  size_t pooled_wasm_stack_size_;
+  size_t number_of_reused_wasm_stacks_;
+  size_t compressed_bytecode_size_;
+  size_t compressed_bytecode_hits_;
+  size_t compressed_bytecode_evictions_;
 
   friend class V8;
   friend class Isolate;
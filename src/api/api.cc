@@ -62,6 +62,7 @@
 #include "src/handles/persistent-handles.h"
 #include "src/handles/shared-object-conveyor-handles.h"
 #include "src/handles/traced-handles-inl.h"
+#include "src/heap/compressed-bytecode-store.h"
 #include "src/heap/heap-inl.h"
 #include "src/heap/heap-write-barrier.h"
 #include "src/heap/safepoint.h"
@@ -125,16 +126,20 @@
 #include "src/snapshot/embedded/embedded-data.h"
 #include "src/snapshot/snapshot.h"
 #include "src/strings/char-predicates-inl.h"
+#include "src/strings/mapped-file-string-resource.h"
 #include "src/strings/string-hasher.h"
 #include "src/strings/unicode-inl.h"
+#include "src/strings/unicode-simd.h"
 #include "src/tracing/trace-event.h"
 #include "src/utils/detachable-vector.h"
 #include "src/utils/identity-map.h"
+#include "src/utils/memcopy.h"
 #include "src/utils/version.h"
 
 #if V8_ENABLE_WEBASSEMBLY
 #include "src/debug/debug-wasm-objects.h"
 #include "src/trap-handler/trap-handler.h"
+#include "src/wasm/stacks.h"
 #include "src/wasm/streaming-decoder.h"
 #include "src/wasm/value-type.h"
 #include "src/wasm/wasm-engine.h"
@@ -2888,6 +2893,15 @@ void ScriptCompiler::ConsumeCodeCacheTask::MergeWithExistingScript() {
   impl_->MergeWithExistingScript();
 }
 
+bool ScriptCompiler::ConsumeCodeCacheTask::ContinueMergeOnMainThread(
+    Isolate* v8_isolate, double max_duration_in_ms) {
+  i::Isolate* i_isolate = reinterpret_cast<i::Isolate*>(v8_isolate);
+  ENTER_V8_NO_SCRIPT_NO_EXCEPTION(i_isolate);
+  return impl_->ContinueMergeWithExistingScript(
+      i_isolate, base::TimeTicks::Now() +
+                     base::TimeDelta::FromMillisecondsD(max_duration_in_ms));
+}
+
 ScriptCompiler::ConsumeCodeCacheTask* ScriptCompiler::StartConsumingCodeCache(
     Isolate* v8_isolate, std::unique_ptr<CachedData> cached_data) {
   if (!i::v8_flags.concurrent_cache_deserialization) return nullptr;
@@ -3476,6 +3490,23 @@ MaybeLocal<String> JSON::Stringify(Local<Context> context,
   RETURN_ESCAPED(result);
 }
 
+Maybe<bool> JSON::StringifyToUtf8Buffer(Local<Context> context,
+                                        Local<Value> json_object,
+                                        Utf8Sink* sink, Local<String> gap) {
+  auto i_isolate = reinterpret_cast<i::Isolate*>(context->GetIsolate());
+  ENTER_V8(i_isolate, context, JSON, Stringify, i::HandleScope);
+  auto object = Utils::OpenHandle(*json_object);
+  i::Handle<i::Object> replacer = i_isolate->factory()->undefined_value();
+  i::Handle<i::String> gap_string = gap.IsEmpty()
+                                        ? i_isolate->factory()->empty_string()
+                                        : Utils::OpenHandle(*gap);
+  has_exception =
+      i::JsonStringifyToUtf8(i_isolate, object, replacer, gap_string, sink)
+          .IsNothing();
+  RETURN_ON_FAILED_EXECUTION_PRIMITIVE(bool);
+  return Just(true);
+}
+
 // --- V a l u e   S e r i a l i z a t i o n ---
 
 SharedValueConveyor::SharedValueConveyor(SharedValueConveyor&& other) noexcept
@@ -5824,9 +5855,20 @@ int String::Utf8Length(Isolate* v8_isolate) const {
     utf8_length += length;
   } else {
     int last_character = unibrow::Utf16::kNoPreviousCharacter;
-    for (uint16_t c : flat.ToUC16Vector()) {
-      utf8_length += unibrow::Utf8::Length(c, last_character);
-      last_character = c;
+    base::Vector<const uint16_t> chars = flat.ToUC16Vector();
+    const uint16_t* cursor = chars.begin();
+    const uint16_t* end = chars.end();
+    while (cursor < end) {
+      // ASCII runs encode to one byte per character.
+      const uint16_t* run_end = i::FindNonAsciiCharacter(cursor, end);
+      if (run_end != cursor) {
+        utf8_length += static_cast<int>(run_end - cursor);
+        last_character = run_end[-1];
+        cursor = run_end;
+        if (cursor == end) break;
+      }
+      utf8_length += unibrow::Utf8::Length(*cursor, last_character);
+      last_character = *cursor++;
     }
   }
   return utf8_length;
@@ -5868,33 +5910,32 @@ static int WriteUtf8Impl(base::Vector<const Char> string, char* write_start,
       if (writable_length <= 0) break;
       up_to = std::min(up_to, read_index + writable_length);
     }
-    // Write the characters to the stream.
-    if (sizeof(Char) == 1) {
-      // Simply memcpy if we only have ASCII characters.
-      uint8_t char_mask = 0;
-      for (int i = read_index; i < up_to; i++) char_mask |= read_start[i];
-      if ((char_mask & 0x80) == 0) {
-        int copy_length = up_to - read_index;
-        memcpy(current_write, read_start + read_index, copy_length);
-        current_write += copy_length;
-        read_index = up_to;
-      } else {
-        for (; read_index < up_to; read_index++) {
-          current_write += unibrow::Utf8::EncodeOneByte(
-              current_write, static_cast<uint8_t>(read_start[read_index]));
-          DCHECK(write_capacity == -1 ||
-                 (current_write - write_start) <= write_capacity);
-        }
+    // Write the characters to the stream. ASCII runs are copied (and narrowed
+    // if necessary) in bulk; only the characters in between are encoded one
+    // at a time.
+    while (read_index < up_to) {
+      const Char* run_end = i::FindNonAsciiCharacter(read_start + read_index,
+                                                     read_start + up_to);
+      int run_length = static_cast<int>(run_end - (read_start + read_index));
+      if (run_length > 0) {
+        i::CopyChars(reinterpret_cast<uint8_t*>(current_write),
+                     read_start + read_index, run_length);
+        current_write += run_length;
+        read_index += run_length;
+        prev_char = read_start[read_index - 1];
+        if (read_index == up_to) break;
       }
-    } else {
-      for (; read_index < up_to; read_index++) {
-        uint16_t character = read_start[read_index];
+      uint16_t character = read_start[read_index++];
+      if (sizeof(Char) == 1) {
+        current_write += unibrow::Utf8::EncodeOneByte(
+            current_write, static_cast<uint8_t>(character));
+      } else {
         current_write += unibrow::Utf8::Encode(current_write, character,
                                                prev_char, replace_invalid_utf8);
-        prev_char = character;
-        DCHECK(write_capacity == -1 ||
-               (current_write - write_start) <= write_capacity);
       }
+      prev_char = character;
+      DCHECK(write_capacity == -1 ||
+             (current_write - write_start) <= write_capacity);
     }
   }
   if (read_index < read_length) {
@@ -6491,7 +6532,13 @@ HeapStatistics::HeapStatistics()
       peak_malloced_memory_(0),
       does_zap_garbage_(false),
       number_of_native_contexts_(0),
-      number_of_detached_contexts_(0) {}
+      number_of_detached_contexts_(0),
+      total_wasm_stack_size_(0),
+      pooled_wasm_stack_size_(0),
+      number_of_reused_wasm_stacks_(0),
+      compressed_bytecode_size_(0),
+      compressed_bytecode_hits_(0),
+      compressed_bytecode_evictions_(0) {}
 
 HeapSpaceStatistics::HeapSpaceStatistics()
     : space_name_(nullptr),
@@ -7620,6 +7667,27 @@ MaybeLocal<String> v8::String::NewExternalOneByte(
   return Utils::ToLocal(string);
 }
 
+MaybeLocal<String> v8::String::NewFromFile(Isolate* v8_isolate,
+                                           const char* path) {
+  std::unique_ptr<base::OS::MemoryMappedFile> file(
+      base::OS::MemoryMappedFile::open(
+          path, base::OS::MemoryMappedFile::FileMode::kReadOnly));
+  if (!file) return MaybeLocal<String>();
+  if (file->size() > static_cast<size_t>(i::String::kMaxLength)) {
+    return MaybeLocal<String>();
+  }
+  const char* chars = static_cast<const char*>(file->memory());
+  int length = static_cast<int>(file->size());
+  if (!i::String::IsAscii(chars, length)) {
+    return NewFromUtf8(v8_isolate, chars, NewStringType::kNormal, length);
+  }
+  // Checking the contents paged in all of the file. Drop it again, so that
+  // only what is actually used, e.g. by the scanner, is paged back in.
+  file->DiscardResidentPages();
+  return NewExternalOneByte(v8_isolate,
+                            new i::MappedFileStringResource(std::move(file)));
+}
+
 bool v8::String::MakeExternal(v8::String::ExternalStringResource* resource) {
   i::DisallowGarbageCollection no_gc;
 
@@ -9946,12 +10014,24 @@ void Isolate::GetHeapStatistics(HeapStatistics* heap_statistics) {
   heap_statistics->number_of_detached_contexts_ =
       heap->NumberOfDetachedContexts();
   heap_statistics->does_zap_garbage_ = i::heap::ShouldZapGarbage();
+  if (i::CompressedBytecodeStore* store = heap->compressed_bytecode_store()) {
+    heap_statistics->compressed_bytecode_size_ = store->size_in_bytes();
+    heap_statistics->compressed_bytecode_hits_ = store->hits();
+    heap_statistics->compressed_bytecode_evictions_ = store->evictions();
+  }
 
 #if V8_ENABLE_WEBASSEMBLY
   heap_statistics->malloced_memory_ +=
       i::wasm::GetWasmEngine()->allocator()->GetCurrentMemoryUsage();
   heap_statistics->peak_malloced_memory_ +=
       i::wasm::GetWasmEngine()->allocator()->GetMaxMemoryUsage();
+  if (i::wasm::StackPool* stack_pool =
+          i_isolate->wasm_stack_pool_if_allocated()) {
+    heap_statistics->total_wasm_stack_size_ = stack_pool->allocated_size();
+    heap_statistics->pooled_wasm_stack_size_ = stack_pool->pooled_size();
+    heap_statistics->number_of_reused_wasm_stacks_ =
+        stack_pool->reused_count();
+  }
 #endif  // V8_ENABLE_WEBASSEMBLY
 }
 
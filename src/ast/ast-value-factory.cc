@@ -32,6 +32,7 @@
 #include "src/common/globals.h"
 #include "src/heap/factory-inl.h"
 #include "src/heap/local-factory-inl.h"
+#include "src/objects/string-table.h"
 #include "src/objects/string.h"
 #include "src/strings/string-hasher.h"
 #include "src/utils/utils-inl.h"
@@ -370,13 +371,39 @@ AstConsString* AstValueFactory::NewConsString(const AstRawString* str1,
 
 template <typename IsolateT>
 void AstValueFactory::Internalize(IsolateT* isolate) {
+  // Non-empty one-byte strings, which are the vast majority, are internalized
+  // in batches so that the string table's write lock is taken once per batch
+  // rather than once per new string.
+  static constexpr size_t kBatchSize = 64;
+  std::vector<OneByteStringKey> keys;
+  std::vector<AstRawString*> batch;
+  keys.reserve(kBatchSize);
+  batch.reserve(kBatchSize);
+  Handle<String> results[kBatchSize];
+  auto flush_batch = [&]() {
+    isolate->string_table()->LookupKeys(isolate, base::VectorOf(keys),
+                                        results);
+    for (size_t i = 0; i < batch.size(); ++i) {
+      batch[i]->set_string(results[i]);
+    }
+    keys.clear();
+    batch.clear();
+  };
+
   // Strings need to be internalized before values, because values refer to
   // strings.
   for (AstRawString* current = strings_; current != nullptr;) {
     AstRawString* next = current->next();
-    current->Internalize(isolate);
+    if (current->is_one_byte() && !current->IsEmpty()) {
+      keys.emplace_back(current->raw_hash_field(), current->literal_bytes_);
+      batch.push_back(current);
+      if (batch.size() == kBatchSize) flush_batch();
+    } else {
+      current->Internalize(isolate);
+    }
     current = next;
   }
+  if (!batch.empty()) flush_batch();
 
   ResetStrings();
 }
@@ -742,6 +742,7 @@ class PosixMemoryMappedFile final : public OS::MemoryMappedFile {
   ~PosixMemoryMappedFile() final;
   void* memory() const final { return memory_; }
   size_t size() const final { return size_; }
+  void DiscardResidentPages() final;
 
  private:
   FILE* const file_;
@@ -805,6 +806,18 @@ PosixMemoryMappedFile::~PosixMemoryMappedFile() {
   fclose(file_);
 }
 
+void PosixMemoryMappedFile::DiscardResidentPages() {
+  if (memory_ == nullptr) return;
+  // Pages of a private mapping that were never written to are backed by the
+  // file, so this does not lose any data. Failing to discard is harmless.
+  size_t size = RoundUp(size_, OS::CommitPageSize());
+#if defined(_AIX) || defined(V8_OS_SOLARIS)
+  USE(madvise(reinterpret_cast<caddr_t>(memory_), size, MADV_DONTNEED));
+#else
+  USE(madvise(memory_, size, MADV_DONTNEED));
+#endif
+}
+
 
 int OS::GetCurrentProcessId() {
   return static_cast<int>(getpid());
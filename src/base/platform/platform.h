@@ -250,6 +250,11 @@ class V8_BASE_EXPORT OS {
     virtual void* memory() const = 0;
     virtual size_t size() const = 0;
 
+    // Drops the pages of a read-only mapping from memory. They are read
+    // back from the file on the next access. Does nothing where this is not
+    // supported.
+    virtual void DiscardResidentPages() {}
+
     static MemoryMappedFile* open(const char* name,
                                   FileMode mode = FileMode::kReadWrite);
     static MemoryMappedFile* create(const char* name, size_t size,
@@ -405,6 +405,42 @@ void RegExpBuiltinsAssembler::GetStringPointers(
   *var_string_end = ReinterpretCast<RawPtrT>(IntPtrAdd(string_data, to_offset));
 }
 
+void RegExpBuiltinsAssembler::GotoIfRequiredLiteralMissing(
+    TNode<FixedArray> data, TNode<RawPtrT> string_start, TNode<IntPtrT> length,
+    String::Encoding encoding, Label* if_missing) {
+  Label out(this);
+  TNode<Object> maybe_literal = UnsafeLoadFixedArrayElement(
+      data, JSRegExp::kIrregexpRequiredLiteralIndex);
+  GotoIf(TaggedIsSmi(maybe_literal), &out);
+
+  TNode<String> literal = CAST(maybe_literal);
+  CSA_DCHECK(this, IsSeqOneByteString(literal));
+  TNode<RawPtrT> literal_start = ReinterpretCast<RawPtrT>(
+      IntPtrAdd(BitcastTaggedToWord(literal),
+                IntPtrConstant(OFFSET_OF_DATA_START(SeqOneByteString) -
+                               kHeapObjectTag)));
+
+  // The search does not allocate, so the raw pointers stay valid.
+  const TNode<ExternalReference> function_addr = ExternalConstant(
+      encoding == String::ONE_BYTE_ENCODING
+          ? ExternalReference::search_string_raw_one_one()
+          : ExternalReference::search_string_raw_two_one());
+  const TNode<ExternalReference> isolate_ptr =
+      ExternalConstant(ExternalReference::isolate_address(isolate()));
+  MachineType type_ptr = MachineType::Pointer();
+  MachineType type_intptr = MachineType::IntPtr();
+  const TNode<IntPtrT> index = UncheckedCast<IntPtrT>(CallCFunction(
+      function_addr, type_intptr, std::make_pair(type_ptr, isolate_ptr),
+      std::make_pair(type_ptr, string_start),
+      std::make_pair(type_intptr, length),
+      std::make_pair(type_ptr, literal_start),
+      std::make_pair(type_intptr, LoadStringLengthAsWord(literal)),
+      std::make_pair(type_intptr, IntPtrConstant(0))));
+  Branch(IntPtrLessThan(index, IntPtrConstant(0)), if_missing, &out);
+
+  BIND(&out);
+}
+
 TNode<HeapObject> RegExpBuiltinsAssembler::RegExpExecInternal(
     TNode<Context> context, TNode<JSRegExp> regexp, TNode<String> string,
     TNode<Number> last_index, TNode<RegExpMatchInfo> match_info,
@@ -497,6 +533,10 @@ TNode<HeapObject> RegExpBuiltinsAssembler::RegExpExecInternal(
       GetStringPointers(direct_string_data, to_direct.offset(), int_last_index,
                         int_string_length, String::ONE_BYTE_ENCODING,
                         &var_string_start, &var_string_end);
+      GotoIfRequiredLiteralMissing(
+          data, var_string_start.value(),
+          IntPtrSub(int_string_length, int_last_index),
+          String::ONE_BYTE_ENCODING, &if_failure);
       var_code =
           UnsafeLoadFixedArrayElement(data, JSRegExp::kIrregexpLatin1CodeIndex);
       var_bytecode = UnsafeLoadFixedArrayElement(
@@ -509,6 +549,10 @@ TNode<HeapObject> RegExpBuiltinsAssembler::RegExpExecInternal(
       GetStringPointers(direct_string_data, to_direct.offset(), int_last_index,
                         int_string_length, String::TWO_BYTE_ENCODING,
                         &var_string_start, &var_string_end);
+      GotoIfRequiredLiteralMissing(
+          data, var_string_start.value(),
+          IntPtrSub(int_string_length, int_last_index),
+          String::TWO_BYTE_ENCODING, &if_failure);
       var_code =
           UnsafeLoadFixedArrayElement(data, JSRegExp::kIrregexpUC16CodeIndex);
       var_bytecode = UnsafeLoadFixedArrayElement(
@@ -50,6 +50,16 @@ class RegExpBuiltinsAssembler : public CodeStubAssembler {
                          TVariable<RawPtrT>* var_string_start,
                          TVariable<RawPtrT>* var_string_end);
 
+  // Jumps to {if_missing} if the regexp in {data} has a required literal (see
+  // RegExpRequiredLiteral) that does not occur in the {length} characters
+  // starting at {string_start}; no match is possible in that case. Sticky and
+  // start-anchored regexps never have a required literal.
+  void GotoIfRequiredLiteralMissing(TNode<FixedArray> data,
+                                    TNode<RawPtrT> string_start,
+                                    TNode<IntPtrT> length,
+                                    String::Encoding encoding,
+                                    Label* if_missing);
+
   // Low level logic around the actual call into pattern matching code.
   TNode<HeapObject> RegExpExecInternal(
       TNode<Context> context, TNode<JSRegExp> regexp, TNode<String> string,
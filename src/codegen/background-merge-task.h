@@ -7,6 +7,7 @@
 
 #include <vector>
 
+#include "src/base/platform/time.h"
 #include "src/handles/maybe-handles.h"
 
 namespace v8 {
@@ -41,6 +42,14 @@ class V8_EXPORT_PRIVATE BackgroundMergeTask {
   // appropriate. May only be called if HasPendingBackgroundWork returned true.
   void BeginMergeInBackground(LocalIsolate* isolate, Handle<Script> new_script);
 
+  // Optional step 3a: on the main thread, do part of the work of step 3,
+  // until {deadline} has passed. Every call makes some progress, so it can
+  // be called repeatedly (e.g. from idle tasks) to keep step 3 short. JS may
+  // run between calls. Returns true once only the final step is left. May only
+  // be called if HasPendingForegroundWork returned true; once it has been
+  // called, the merge has to be completed with CompleteMergeInForeground.
+  bool ContinueMergeInForeground(Isolate* isolate, base::TimeTicks deadline);
+
   // Step 3: on the main thread again, complete the merge so that all relevant
   // objects are reachable from the cached Script. May only be called if
   // HasPendingForegroundWork returned true. Returns the top-level
@@ -56,6 +65,10 @@ class V8_EXPORT_PRIVATE BackgroundMergeTask {
   }
 
  private:
+  // Adds used_new_sfis_ to the cached script, or, where the cached script
+  // gained SharedFunctionInfos of its own, forwards all pointers to them.
+  void HandleUsedNewSfis(Isolate* isolate);
+
   std::unique_ptr<PersistentHandles> persistent_handles_;
 
   // Data from main thread:
@@ -86,6 +99,14 @@ class V8_EXPORT_PRIVATE BackgroundMergeTask {
   };
   std::vector<NewCompiledDataForCachedSfi> new_compiled_data_for_cached_sfis_;
 
+  // Progress of the main thread through the two lists above. All of
+  // used_new_sfis_ is handled in the first foreground step, before any compiled
+  // data is copied to cached SharedFunctionInfos. Otherwise, JS running between
+  // steps could create closures for new SharedFunctionInfos that are only
+  // later replaced by ones the cached script gained in the meantime.
+  bool used_new_sfis_handled_ = false;
+  size_t next_new_compiled_data_for_cached_sfi_ = 0;
+
   enum State {
     kNotStarted,
     kPendingBackgroundWork,
@@ -4,7 +4,12 @@
 
 #include "src/codegen/compilation-cache.h"
 
+#include <iterator>
+
+#include "src/base/functional.h"
+#include "src/base/lazy-instance.h"
 #include "src/common/globals.h"
+#include "src/flags/flags.h"
 #include "src/heap/factory.h"
 #include "src/logging/counters.h"
 #include "src/logging/log.h"
@@ -13,6 +18,7 @@
 #include "src/objects/objects.h"
 #include "src/objects/slots.h"
 #include "src/objects/visitors.h"
+#include "src/snapshot/code-serializer.h"
 #include "src/utils/ostreams.h"
 
 namespace v8 {
@@ -373,6 +379,156 @@ void CompilationCache::MarkCompactPrologue() {
   reg_exp_.Age();
 }
 
+namespace {
+
+// Hashes and copies the raw characters of a flat {source}.
+template <typename Char>
+void GetSourceBytes(base::Vector<const Char> chars, size_t* hash,
+                    std::vector<uint8_t>* bytes) {
+  *hash = base::hash_range(chars.begin(), chars.end());
+  if (bytes) {
+    const uint8_t* begin = reinterpret_cast<const uint8_t*>(chars.begin());
+    bytes->assign(begin, begin + chars.length() * sizeof(Char));
+  }
+}
+
+template <typename Char>
+base::Vector<const uint8_t> AsBytes(base::Vector<const Char> chars) {
+  return base::Vector<const uint8_t>(
+      reinterpret_cast<const uint8_t*>(chars.begin()),
+      chars.length() * sizeof(Char));
+}
+
+}  // namespace
+
+DEFINE_LAZY_LEAKY_OBJECT_GETTER(ProcessWideScriptCache,
+                                ProcessWideScriptCache::Get)
+
+ProcessWideScriptCache::EntryList::iterator
+ProcessWideScriptCache::FindEntryLocked(
+    size_t hash, int origin_flags, uint32_t flag_hash, bool is_one_byte,
+    base::Vector<const uint8_t> source) {
+  mutex_.AssertHeld();
+  auto range = entries_by_hash_.equal_range(hash);
+  for (auto it = range.first; it != range.second; ++it) {
+    const Entry& entry = *it->second;
+    if (entry.origin_flags == origin_flags && entry.flag_hash == flag_hash &&
+        entry.is_one_byte == is_one_byte &&
+        entry.source.size() == source.size() &&
+        memcmp(entry.source.data(), source.begin(), source.size()) == 0) {
+      return it->second;
+    }
+  }
+  return entries_.end();
+}
+
+ProcessWideScriptCache::Data ProcessWideScriptCache::Lookup(
+    Isolate* isolate, Handle<String> source,
+    ScriptOriginOptions origin_options) {
+  source = String::Flatten(isolate, source);
+  const uint32_t flag_hash = FlagList::Hash();
+  DisallowGarbageCollection no_gc;
+  String::FlatContent content = source->GetFlatContent(no_gc);
+  size_t hash;
+  base::Vector<const uint8_t> source_bytes;
+  if (content.IsOneByte()) {
+    GetSourceBytes(content.ToOneByteVector(), &hash, nullptr);
+    source_bytes = AsBytes(content.ToOneByteVector());
+  } else {
+    GetSourceBytes(content.ToUC16Vector(), &hash, nullptr);
+    source_bytes = AsBytes(content.ToUC16Vector());
+  }
+
+  base::MutexGuard guard(&mutex_);
+  EntryList::iterator entry =
+      FindEntryLocked(hash, origin_options.Flags(), flag_hash,
+                      content.IsOneByte(), source_bytes);
+  if (entry == entries_.end()) return nullptr;
+  entry->used_since_last_age = true;
+  return entry->data;
+}
+
+void ProcessWideScriptCache::Put(Isolate* isolate, Handle<String> source,
+                                 ScriptOriginOptions origin_options,
+                                 Handle<SharedFunctionInfo> function_info) {
+  std::unique_ptr<ScriptCompiler::CachedData> cached_data(
+      CodeSerializer::Serialize(isolate, function_info));
+  if (!cached_data) return;
+
+  Entry entry;
+  entry.origin_flags = origin_options.Flags();
+  entry.flag_hash = FlagList::Hash();
+  entry.data = std::make_shared<const std::vector<uint8_t>>(
+      cached_data->data, cached_data->data + cached_data->length);
+  entry.used_since_last_age = true;
+  source = String::Flatten(isolate, source);
+  {
+    DisallowGarbageCollection no_gc;
+    String::FlatContent content = source->GetFlatContent(no_gc);
+    entry.is_one_byte = content.IsOneByte();
+    if (content.IsOneByte()) {
+      GetSourceBytes(content.ToOneByteVector(), &entry.hash, &entry.source);
+    } else {
+      GetSourceBytes(content.ToUC16Vector(), &entry.hash, &entry.source);
+    }
+  }
+
+  const size_t budget = v8_flags.process_wide_script_cache_size * MB;
+  if (entry.size_in_bytes() > budget) return;
+
+  base::MutexGuard guard(&mutex_);
+  // Replace data for the same key, e.g. data that another isolate rejected.
+  EntryList::iterator old_entry = FindEntryLocked(
+      entry.hash, entry.origin_flags, entry.flag_hash, entry.is_one_byte,
+      base::VectorOf(entry.source));
+  if (old_entry != entries_.end()) RemoveEntryLocked(old_entry);
+  while (size_in_bytes_ + entry.size_in_bytes() > budget) {
+    RemoveEntryLocked(entries_.begin());
+  }
+  size_in_bytes_ += entry.size_in_bytes();
+  size_t hash = entry.hash;
+  entries_.push_back(std::move(entry));
+  entries_by_hash_.emplace(hash, std::prev(entries_.end()));
+}
+
+void ProcessWideScriptCache::Age() {
+  base::MutexGuard guard(&mutex_);
+  for (auto it = entries_.begin(); it != entries_.end();) {
+    auto next = std::next(it);
+    if (it->used_since_last_age) {
+      it->used_since_last_age = false;
+    } else {
+      RemoveEntryLocked(it);
+    }
+    it = next;
+  }
+}
+
+void ProcessWideScriptCache::Clear() {
+  base::MutexGuard guard(&mutex_);
+  entries_by_hash_.clear();
+  entries_.clear();
+  size_in_bytes_ = 0;
+}
+
+size_t ProcessWideScriptCache::size_in_bytes() const {
+  base::MutexGuard guard(&mutex_);
+  return size_in_bytes_;
+}
+
+void ProcessWideScriptCache::RemoveEntryLocked(EntryList::iterator entry) {
+  mutex_.AssertHeld();
+  auto range = entries_by_hash_.equal_range(entry->hash);
+  for (auto it = range.first; it != range.second; ++it) {
+    if (it->second == entry) {
+      entries_by_hash_.erase(it);
+      break;
+    }
+  }
+  size_in_bytes_ -= entry->size_in_bytes();
+  entries_.erase(entry);
+}
+
 void CompilationCache::EnableScriptAndEval() {
   enabled_script_and_eval_ = true;
 }
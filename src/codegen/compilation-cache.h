@@ -5,7 +5,15 @@
 #ifndef V8_CODEGEN_COMPILATION_CACHE_H_
 #define V8_CODEGEN_COMPILATION_CACHE_H_
 
+#include <list>
+#include <memory>
+#include <unordered_map>
+#include <vector>
+
+#include "include/v8-message.h"
 #include "src/base/hashmap.h"
+#include "src/base/platform/mutex.h"
+#include "src/base/vector.h"
 #include "src/objects/compilation-cache-table.h"
 #include "src/utils/allocation.h"
 
@@ -132,6 +140,73 @@ class CompilationCacheRegExp {
   DISALLOW_IMPLICIT_CONSTRUCTORS(CompilationCacheRegExp);
 };
 
+// Code cache data (see CodeSerializer) for top-level scripts, shared by all
+// isolates in the process. Bytecode lives on each isolate's heap and cannot be
+// shared directly, but deserializing it is much cheaper than parsing and
+// compiling, so an isolate that misses its own compilation cache can reuse the
+// work another isolate did for the same source. Entries are keyed by the
+// source contents, the origin options and the flag hash; the code serializer's
+// sanity checks reject data that does not fit the consuming isolate.
+class V8_EXPORT_PRIVATE ProcessWideScriptCache final {
+ public:
+  using Data = std::shared_ptr<const std::vector<uint8_t>>;
+
+  static ProcessWideScriptCache* Get();
+
+  ProcessWideScriptCache() = default;
+  ProcessWideScriptCache(const ProcessWideScriptCache&) = delete;
+  ProcessWideScriptCache& operator=(const ProcessWideScriptCache&) = delete;
+
+  // Returns the code cache data for {source}, or nullptr if there is none.
+  Data Lookup(Isolate* isolate, Handle<String> source,
+              ScriptOriginOptions origin_options);
+
+  // Serializes {function_info}, the top-level function of a script that was
+  // just compiled from {source}, and adds it to the cache.
+  void Put(Isolate* isolate, Handle<String> source,
+           ScriptOriginOptions origin_options,
+           Handle<SharedFunctionInfo> function_info);
+
+  // Evicts the entries that were not looked up since the last call. This is
+  // driven by the memory reducer.
+  void Age();
+
+  // Evicts all entries.
+  void Clear();
+
+  size_t size_in_bytes() const;
+
+ private:
+  struct Entry {
+    size_t hash;
+    int origin_flags;
+    uint32_t flag_hash;
+    bool is_one_byte;
+    // The raw source characters, to tell apart sources with the same hash.
+    std::vector<uint8_t> source;
+    Data data;
+    bool used_since_last_age;
+
+    size_t size_in_bytes() const { return source.size() + data->size(); }
+  };
+
+  using EntryList = std::list<Entry>;
+
+  // Returns the entry for the given key, or {entries_.end()}. {source} holds
+  // the raw source characters.
+  EntryList::iterator FindEntryLocked(size_t hash, int origin_flags,
+                                      uint32_t flag_hash, bool is_one_byte,
+                                      base::Vector<const uint8_t> source);
+  void RemoveEntryLocked(EntryList::iterator entry);
+
+  mutable base::Mutex mutex_;
+  // Oldest entries first; evicted from the front when over budget.
+  EntryList entries_;
+  // {entries_} indexed by the hash of their source.
+  std::unordered_multimap<size_t, EntryList::iterator> entries_by_hash_;
+  size_t size_in_bytes_ = 0;
+};
+
 // The compilation cache keeps shared function infos for compiled
 // scripts and evals. The shared function infos are looked up using
 // the source string as the key. For regular expressions the
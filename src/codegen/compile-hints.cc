@@ -0,0 +1,247 @@
+// Copyright 2024 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#include "src/codegen/compile-hints.h"
+
+#include <algorithm>
+
+#include "src/base/platform/mutex.h"
+#include "src/base/vlq.h"
+#include "src/objects/script-inl.h"
+#include "src/objects/string-inl.h"
+#include "src/parsing/scanner.h"
+#include "src/utils/utils.h"
+
+namespace v8 {
+namespace internal {
+
+namespace {
+
+constexpr uint32_t kMagicNumber = 0xC0DE4854;
+constexpr uint32_t kFormatVersion = 1;
+
+// The number of characters that make up the fingerprint of a script. Long
+// enough to tell apart scripts that share a license header.
+constexpr int kFingerprintLength = 16 * KB;
+
+// Serializes CompileHintsRecorder::WriteToFile across isolates.
+base::LazyMutex output_mutex = LAZY_MUTEX_INITIALIZER;
+// Whether an isolate of this process has written the output file yet.
+bool output_written = false;
+
+void SortAndDeduplicate(CompileHints::Positions* positions) {
+  std::sort(positions->begin(), positions->end());
+  positions->erase(std::unique(positions->begin(), positions->end()),
+                   positions->end());
+}
+
+// FNV-1a; the fingerprints have to be stable across processes.
+class Fingerprinter {
+ public:
+  void Add(uint16_t c) {
+    hash_ = (hash_ ^ (c & 0xFF)) * kPrime;
+    hash_ = (hash_ ^ (c >> 8)) * kPrime;
+  }
+  uint32_t hash() const { return hash_; }
+
+ private:
+  static constexpr uint32_t kPrime = 16777619u;
+  uint32_t hash_ = 2166136261u;
+};
+
+class Writer {
+ public:
+  void WriteUint32(uint32_t value) {
+    for (int i = 0; i < 4; i++) data_.push_back((value >> (8 * i)) & 0xFF);
+  }
+  void WriteVLQ(uint32_t value) { base::VLQEncodeUnsigned(&data_, value); }
+  std::vector<uint8_t> Finish() { return std::move(data_); }
+
+ private:
+  std::vector<uint8_t> data_;
+};
+
+class Reader {
+ public:
+  explicit Reader(base::Vector<const uint8_t> data) : data_(data) {}
+
+  bool ReadUint32(uint32_t* value) {
+    if (data_.length() - position_ < 4) return false;
+    *value = 0;
+    for (int i = 0; i < 4; i++) {
+      *value |= static_cast<uint32_t>(data_[position_++]) << (8 * i);
+    }
+    return true;
+  }
+  bool ReadVLQ(uint32_t* value) {
+    bool truncated = false;
+    *value = base::VLQDecodeUnsigned([&]() -> uint8_t {
+      if (position_ == data_.length()) {
+        truncated = true;
+        return 0;
+      }
+      return data_[position_++];
+    });
+    return !truncated;
+  }
+  bool AtEnd() const { return position_ == data_.length(); }
+
+ private:
+  base::Vector<const uint8_t> data_;
+  size_t position_ = 0;
+};
+
+}  // namespace
+
+// static
+std::unique_ptr<CompileHints> CompileHints::Deserialize(
+    base::Vector<const uint8_t> data) {
+  Reader reader(data);
+  uint32_t magic_number, version, script_count;
+  if (!reader.ReadUint32(&magic_number) || magic_number != kMagicNumber ||
+      !reader.ReadUint32(&version) || version != kFormatVersion ||
+      !reader.ReadUint32(&script_count)) {
+    return nullptr;
+  }
+  auto hints = std::make_unique<CompileHints>();
+  for (uint32_t i = 0; i < script_count; i++) {
+    uint32_t fingerprint, position_count;
+    if (!reader.ReadUint32(&fingerprint) ||
+        !reader.ReadUint32(&position_count)) {
+      return nullptr;
+    }
+    // Every position takes at least one byte.
+    if (position_count > data.length()) return nullptr;
+    Positions& positions = hints->scripts_[fingerprint];
+    positions.reserve(positions.size() + position_count);
+    int64_t position = 0;
+    for (uint32_t j = 0; j < position_count; j++) {
+      uint32_t delta;
+      if (!reader.ReadVLQ(&delta)) return nullptr;
+      position += delta;
+      if (position > kMaxInt) return nullptr;
+      positions.push_back(static_cast<int>(position));
+    }
+  }
+  if (!reader.AtEnd()) return nullptr;
+  // Files are written sorted, but a script may still be listed twice.
+  for (auto& [fingerprint, positions] : hints->scripts_) {
+    SortAndDeduplicate(&positions);
+  }
+  return hints;
+}
+
+std::vector<uint8_t> CompileHints::Serialize() const {
+  Writer writer;
+  writer.WriteUint32(kMagicNumber);
+  writer.WriteUint32(kFormatVersion);
+  writer.WriteUint32(static_cast<uint32_t>(scripts_.size()));
+  // Write the scripts in the order of their fingerprints, so that the same
+  // hints always give the same file.
+  std::vector<uint32_t> fingerprints;
+  fingerprints.reserve(scripts_.size());
+  for (const auto& [fingerprint, positions] : scripts_) {
+    fingerprints.push_back(fingerprint);
+  }
+  std::sort(fingerprints.begin(), fingerprints.end());
+  for (uint32_t fingerprint : fingerprints) {
+    Positions positions = scripts_.at(fingerprint);
+    SortAndDeduplicate(&positions);
+    writer.WriteUint32(fingerprint);
+    writer.WriteUint32(static_cast<uint32_t>(positions.size()));
+    int previous = 0;
+    for (int position : positions) {
+      writer.WriteVLQ(static_cast<uint32_t>(position - previous));
+      previous = position;
+    }
+  }
+  return writer.Finish();
+}
+
+// static
+std::unique_ptr<CompileHints> CompileHints::ReadFromFile(
+    const char* filename) {
+  bool exists;
+  std::string data = ReadFile(filename, &exists, false);
+  if (!exists) return nullptr;
+  return Deserialize(base::Vector<const uint8_t>(
+      reinterpret_cast<const uint8_t*>(data.data()), data.size()));
+}
+
+// static
+uint32_t CompileHints::Fingerprint(Utf16CharacterStream* stream) {
+  DCHECK_EQ(0u, stream->pos());
+  Fingerprinter fingerprinter;
+  for (int i = 0; i < kFingerprintLength; i++) {
+    base::uc32 c = stream->Advance();
+    if (c == Utf16CharacterStream::kEndOfInput) break;
+    fingerprinter.Add(static_cast<uint16_t>(c));
+  }
+  stream->Seek(0);
+  return fingerprinter.hash();
+}
+
+// static
+uint32_t CompileHints::Fingerprint(Isolate* isolate, Handle<String> source) {
+  source = String::Flatten(isolate, source);
+  DisallowGarbageCollection no_gc;
+  String::FlatContent content = source->GetFlatContent(no_gc);
+  Fingerprinter fingerprinter;
+  int length = std::min(source->length(), kFingerprintLength);
+  for (int i = 0; i < length; i++) fingerprinter.Add(content.Get(i));
+  return fingerprinter.hash();
+}
+
+void CompileHints::Add(const CompileHints& other) {
+  for (const auto& [fingerprint, positions] : other.scripts_) {
+    Positions& own_positions = scripts_[fingerprint];
+    own_positions.insert(own_positions.end(), positions.begin(),
+                         positions.end());
+  }
+}
+
+const CompileHints::Positions* CompileHints::Lookup(
+    uint32_t fingerprint) const {
+  auto it = scripts_.find(fingerprint);
+  return it == scripts_.end() ? nullptr : &it->second;
+}
+
+// static
+bool CompileHints::ShouldEagerCompile(int position, void* data) {
+  const Positions* positions = static_cast<const Positions*>(data);
+  return std::binary_search(positions->begin(), positions->end(), position);
+}
+
+void CompileHintsRecorder::RecordLazyCompile(Isolate* isolate,
+                                             Handle<Script> script,
+                                             int position) {
+  // Eval code is never streamed.
+  if (script->compilation_type() == Script::CompilationType::kEval) return;
+  auto it = fingerprints_.find(script->id());
+  if (it == fingerprints_.end()) {
+    if (!IsString(script->source())) return;
+    uint32_t fingerprint = CompileHints::Fingerprint(
+        isolate, handle(String::cast(script->source()), isolate));
+    it = fingerprints_.emplace(script->id(), fingerprint).first;
+  }
+  hints_.Add(it->second, position);
+}
+
+void CompileHintsRecorder::WriteToFile(const char* filename) const {
+  base::MutexGuard guard(output_mutex.Pointer());
+  std::vector<uint8_t> data;
+  std::unique_ptr<CompileHints> written;
+  if (output_written) written = CompileHints::ReadFromFile(filename);
+  if (written) {
+    written->Add(hints_);
+    data = written->Serialize();
+  } else {
+    data = hints_.Serialize();
+  }
+  WriteBytes(filename, data.data(), static_cast<int>(data.size()));
+  output_written = true;
+}
+
+}  // namespace internal
+}  // namespace v8
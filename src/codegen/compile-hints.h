@@ -0,0 +1,101 @@
+// Copyright 2024 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#ifndef V8_CODEGEN_COMPILE_HINTS_H_
+#define V8_CODEGEN_COMPILE_HINTS_H_
+
+#include <cstdint>
+#include <memory>
+#include <unordered_map>
+#include <vector>
+
+#include "src/base/vector.h"
+#include "src/common/globals.h"
+#include "src/handles/handles.h"
+
+namespace v8 {
+namespace internal {
+
+class Script;
+class String;
+class Utf16CharacterStream;
+
+// The functions of a set of scripts that should be compiled eagerly, as
+// source positions. Scripts are identified by a fingerprint of the beginning
+// of their source, which is all that is known when a streaming compile
+// starts. A hint that does not fit the script it is applied to only costs
+// the time of compiling the wrong function.
+//
+// The binary format is a magic number and a format version, followed by the
+// number of scripts and, for each script, its fingerprint, the number of
+// positions and the positions in increasing order. Positions are stored as
+// VLQ-encoded deltas and everything else as little-endian 32-bit integers.
+class V8_EXPORT_PRIVATE CompileHints final {
+ public:
+  // The sorted start positions of the functions to compile eagerly in one
+  // script.
+  using Positions = std::vector<int>;
+
+  CompileHints() = default;
+  CompileHints(const CompileHints&) = delete;
+  CompileHints& operator=(const CompileHints&) = delete;
+
+  // Returns nullptr if {data} is not in the format above. Scripts listed more
+  // than once are merged, and their positions sorted and deduplicated.
+  static std::unique_ptr<CompileHints> Deserialize(
+      base::Vector<const uint8_t> data);
+  std::vector<uint8_t> Serialize() const;
+
+  // Reads the hints written by a previous run (see CompileHintsRecorder).
+  // Returns nullptr if the file does not exist or cannot be read.
+  static std::unique_ptr<CompileHints> ReadFromFile(const char* filename);
+
+  // The fingerprint of the source read by {stream}, or of {source}; both
+  // agree for the same characters. The stream is left at position 0.
+  static uint32_t Fingerprint(Utf16CharacterStream* stream);
+  static uint32_t Fingerprint(Isolate* isolate, Handle<String> source);
+
+  // Positions are only sorted by Serialize, so only deserialized hints can
+  // be looked up.
+  void Add(uint32_t fingerprint, int position) {
+    scripts_[fingerprint].push_back(position);
+  }
+  void Add(const CompileHints& other);
+  const Positions* Lookup(uint32_t fingerprint) const;
+
+  // A CompileHintCallback for a Positions list passed as {data}.
+  static bool ShouldEagerCompile(int position, void* data);
+
+ private:
+  std::unordered_map<uint32_t, Positions> scripts_;
+};
+
+// Records the functions that are compiled lazily on the main thread, to be
+// written out as CompileHints when the isolate is torn down. The next run can
+// then compile these functions on the worker thread that streams their
+// script, instead of on the main thread when they are first called.
+class CompileHintsRecorder final {
+ public:
+  CompileHintsRecorder() = default;
+  CompileHintsRecorder(const CompileHintsRecorder&) = delete;
+  CompileHintsRecorder& operator=(const CompileHintsRecorder&) = delete;
+
+  void RecordLazyCompile(Isolate* isolate, Handle<Script> script,
+                         int position);
+
+  // All isolates of the process write to the same file. The first one to be
+  // torn down replaces the file of a previous run, and the others merge their
+  // hints into it.
+  void WriteToFile(const char* filename) const;
+
+ private:
+  // Fingerprints by script id, computed on the first lazy compile.
+  std::unordered_map<int, uint32_t> fingerprints_;
+  CompileHints hints_;
+};
+
+}  // namespace internal
+}  // namespace v8
+
+#endif  // V8_CODEGEN_COMPILE_HINTS_H_
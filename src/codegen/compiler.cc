@@ -13,10 +13,12 @@
 #include "src/ast/scopes.h"
 #include "src/base/logging.h"
 #include "src/base/optional.h"
+#include "src/base/platform/elapsed-timer.h"
 #include "src/base/platform/time.h"
 #include "src/baseline/baseline.h"
 #include "src/codegen/assembler-inl.h"
 #include "src/codegen/compilation-cache.h"
+#include "src/codegen/compile-hints.h"
 #include "src/codegen/optimized-compilation-info.h"
 #include "src/codegen/pending-optimization-table.h"
 #include "src/codegen/script-details.h"
@@ -40,6 +42,7 @@
 #include "src/handles/handles.h"
 #include "src/handles/maybe-handles.h"
 #include "src/handles/persistent-handles.h"
+#include "src/heap/compressed-bytecode-store.h"
 #include "src/heap/heap-inl.h"
 #include "src/heap/local-factory-inl.h"
 #include "src/heap/local-heap-inl.h"
@@ -1501,6 +1504,32 @@ void FinalizeUnoptimizedCompilation(
   }
 }
 
+// Does what FinalizeUnoptimizedCompilation does for a lazily compiled function,
+// for bytecode that was restored from the CompressedBytecodeStore instead.
+void FinalizeRestoredCompilation(Isolate* isolate, Handle<Script> script,
+                                 const UnoptimizedCompileFlags& flags,
+                                 Handle<SharedFunctionInfo> shared_info,
+                                 base::TimeDelta time_taken_to_restore) {
+  if (v8_flags.stress_lazy_source_positions ||
+      (!flags.collect_source_positions() && isolate->NeedsSourcePositions())) {
+    SharedFunctionInfo::EnsureSourcePositionsAvailable(isolate, shared_info);
+  }
+  LogEventListener::CodeTag log_tag;
+  if (shared_info->is_toplevel()) {
+    log_tag = flags.is_eval() ? LogEventListener::CodeTag::kEval
+                              : LogEventListener::CodeTag::kScript;
+  } else {
+    log_tag = LogEventListener::CodeTag::kFunction;
+  }
+  log_tag = V8FileLogger::ToNativeByScript(log_tag, *script);
+  if (v8_flags.interpreted_frames_native_stack &&
+      isolate->logger()->is_listening_to_code_events()) {
+    Compiler::InstallInterpreterTrampolineCopy(isolate, shared_info, log_tag);
+  }
+  LogUnoptimizedCompilation(isolate, shared_info, log_tag,
+                            time_taken_to_restore, base::TimeDelta());
+}
+
 void FinalizeUnoptimizedScriptCompilation(
     Isolate* isolate, Handle<Script> script,
     const UnoptimizedCompileFlags& flags,
@@ -1527,6 +1556,29 @@ void CompileAllWithBaseline(Isolate* isolate,
   }
 }
 
+// Records a lazily compiled function for the compile hints of its script, and
+// for --compile-hints-output.
+void RecordLazyCompilation(Isolate* isolate, Handle<Script> script,
+                           Handle<SharedFunctionInfo> shared_info) {
+  if (script->produce_compile_hints()) {
+    // Log lazy funtion compilation.
+    Handle<ArrayList> list;
+    if (IsUndefined(script->compiled_lazy_function_positions())) {
+      constexpr int kInitialLazyFunctionPositionListSize = 100;
+      list = ArrayList::New(isolate, kInitialLazyFunctionPositionListSize);
+    } else {
+      list = handle(ArrayList::cast(script->compiled_lazy_function_positions()),
+                    isolate);
+    }
+    list = ArrayList::Add(isolate, list,
+                          Smi::FromInt(shared_info->StartPosition()));
+    script->set_compiled_lazy_function_positions(*list);
+  }
+  if (CompileHintsRecorder* recorder = isolate->compile_hints_recorder()) {
+    recorder->RecordLazyCompile(isolate, script, shared_info->StartPosition());
+  }
+}
+
 // Create shared function info for top level and shared function infos array for
 // inner functions.
 template <typename IsolateT>
@@ -1685,6 +1737,7 @@ BackgroundCompileTask::BackgroundCompileTask(
   } else {
     DCHECK_NULL(compile_hint_callback);
     DCHECK_NULL(compile_hint_callback_data);
+    if (flags_.allow_lazy_compile()) compile_hints_ = isolate->compile_hints();
   }
 }
 
@@ -1905,8 +1958,21 @@ void BackgroundCompileTask::Run(
   ParseInfo info(isolate, flags_, &compile_state_, reusable_state,
                  GetCurrentStackPosition() - stack_size_ * KB);
   info.set_character_stream(std::move(character_stream_));
-  info.SetCompileHintCallbackAndData(compile_hint_callback_,
-                                     compile_hint_callback_data_);
+  CompileHintCallback compile_hint_callback = compile_hint_callback_;
+  void* compile_hint_callback_data = compile_hint_callback_data_;
+  if (compile_hints_) {
+    // Compile the functions that an earlier run compiled lazily, see
+    // CompileHintsRecorder.
+    const CompileHints::Positions* positions = compile_hints_->Lookup(
+        CompileHints::Fingerprint(info.character_stream()));
+    if (positions != nullptr) {
+      compile_hint_callback = &CompileHints::ShouldEagerCompile;
+      compile_hint_callback_data =
+          const_cast<CompileHints::Positions*>(positions);
+    }
+  }
+  info.SetCompileHintCallbackAndData(compile_hint_callback,
+                                     compile_hint_callback_data);
   if (is_streaming_compilation()) info.set_is_streaming_compilation();
 
   if (toplevel_script_compilation) {
@@ -2186,32 +2252,12 @@ void BackgroundMergeTask::BeginMergeInBackground(LocalIsolate* isolate,
   state_ = kPendingForegroundWork;
 }
 
-Handle<SharedFunctionInfo> BackgroundMergeTask::CompleteMergeInForeground(
-    Isolate* isolate, Handle<Script> new_script) {
-  DCHECK_EQ(state_, kPendingForegroundWork);
-
-  HandleScope handle_scope(isolate);
+void BackgroundMergeTask::HandleUsedNewSfis(Isolate* isolate) {
   ConstantPoolPointerForwarder forwarder(isolate,
                                          isolate->main_thread_local_heap());
 
   Handle<Script> old_script = cached_script_.ToHandleChecked();
 
-  for (const auto& new_compiled_data : new_compiled_data_for_cached_sfis_) {
-    if (!new_compiled_data.cached_sfi->is_compiled() &&
-        new_compiled_data.new_sfi->is_compiled()) {
-      // Updating existing DebugInfos is not supported, but we don't expect
-      // uncompiled SharedFunctionInfos to contain DebugInfos.
-      DCHECK(!new_compiled_data.cached_sfi->HasDebugInfo(isolate));
-      // The goal here is to copy every field except script from
-      // new_sfi to cached_sfi. The safest way to do so (including a DCHECK that
-      // no fields were skipped) is to first copy the script from
-      // cached_sfi to new_sfi, and then copy every field using CopyFrom.
-      new_compiled_data.new_sfi->set_script(
-          new_compiled_data.cached_sfi->script(kAcquireLoad), kReleaseStore);
-      new_compiled_data.cached_sfi->CopyFrom(*new_compiled_data.new_sfi,
-                                             isolate);
-    }
-  }
   for (Handle<SharedFunctionInfo> new_sfi : used_new_sfis_) {
     DisallowGarbageCollection no_gc;
     DCHECK_GE(new_sfi->function_literal_id(), 0);
@@ -2233,7 +2279,8 @@ Handle<SharedFunctionInfo> BackgroundMergeTask::CompleteMergeInForeground(
 
   // Most of the time, the background merge was sufficient. However, if there
   // are any new pointers that need forwarding, a new traversal of the constant
-  // pools is required.
+  // pools is required. The compiled data for cached SFIs hasn't been copied
+  // yet, so its bytecode is still found on the new SFIs.
   if (forwarder.HasAnythingToForward()) {
     for (Handle<SharedFunctionInfo> new_sfi : used_new_sfis_) {
       if (new_sfi->HasBytecodeArray(isolate)) {
@@ -2241,13 +2288,71 @@ Handle<SharedFunctionInfo> BackgroundMergeTask::CompleteMergeInForeground(
       }
     }
     for (const auto& new_compiled_data : new_compiled_data_for_cached_sfis_) {
-      if (new_compiled_data.cached_sfi->HasBytecodeArray(isolate)) {
+      if (new_compiled_data.new_sfi->HasBytecodeArray(isolate)) {
         forwarder.AddBytecodeArray(
-            new_compiled_data.cached_sfi->GetBytecodeArray(isolate));
+            new_compiled_data.new_sfi->GetBytecodeArray(isolate));
       }
     }
     forwarder.IterateAndForwardPointers();
   }
+}
+
+bool BackgroundMergeTask::ContinueMergeInForeground(
+    Isolate* isolate, base::TimeTicks deadline) {
+  DCHECK_EQ(state_, kPendingForegroundWork);
+
+  HandleScope handle_scope(isolate);
+
+  // Do at least one item per call, so that callers with a short budget still
+  // make progress.
+  bool made_progress = false;
+  auto out_of_time = [&]() {
+    return made_progress && !deadline.IsMax() &&
+           base::TimeTicks::Now() >= deadline;
+  };
+
+  // This is a single item, as no new bytecode may become reachable from the
+  // cached script before all SFIs it refers to are final.
+  if (!used_new_sfis_handled_) {
+    HandleUsedNewSfis(isolate);
+    used_new_sfis_handled_ = true;
+    made_progress = true;
+  }
+
+  for (; next_new_compiled_data_for_cached_sfi_ <
+         new_compiled_data_for_cached_sfis_.size();
+       ++next_new_compiled_data_for_cached_sfi_) {
+    if (out_of_time()) return false;
+    made_progress = true;
+    const auto& new_compiled_data =
+        new_compiled_data_for_cached_sfis_
+            [next_new_compiled_data_for_cached_sfi_];
+    if (!new_compiled_data.cached_sfi->is_compiled() &&
+        new_compiled_data.new_sfi->is_compiled()) {
+      // Updating existing DebugInfos is not supported, but we don't expect
+      // uncompiled SharedFunctionInfos to contain DebugInfos.
+      DCHECK(!new_compiled_data.cached_sfi->HasDebugInfo(isolate));
+      // The goal here is to copy every field except script from
+      // new_sfi to cached_sfi. The safest way to do so (including a DCHECK that
+      // no fields were skipped) is to first copy the script from
+      // cached_sfi to new_sfi, and then copy every field using CopyFrom.
+      new_compiled_data.new_sfi->set_script(
+          new_compiled_data.cached_sfi->script(kAcquireLoad), kReleaseStore);
+      new_compiled_data.cached_sfi->CopyFrom(*new_compiled_data.new_sfi,
+                                             isolate);
+    }
+  }
+  return true;
+}
+
+Handle<SharedFunctionInfo> BackgroundMergeTask::CompleteMergeInForeground(
+    Isolate* isolate, Handle<Script> new_script) {
+  DCHECK_EQ(state_, kPendingForegroundWork);
+
+  CHECK(ContinueMergeInForeground(isolate, base::TimeTicks::Max()));
+
+  HandleScope handle_scope(isolate);
+  Handle<Script> old_script = cached_script_.ToHandleChecked();
 
   MaybeObject maybe_toplevel_sfi =
       old_script->shared_function_infos()->get(kFunctionLiteralIdTopLevel);
@@ -2448,6 +2553,12 @@ void BackgroundDeserializeTask::MergeWithExistingScript() {
       &isolate, off_thread_data_.GetOnlyScript(isolate.heap()));
 }
 
+bool BackgroundDeserializeTask::ContinueMergeWithExistingScript(
+    Isolate* isolate, base::TimeTicks deadline) {
+  if (!background_merge_task_.HasPendingForegroundWork()) return true;
+  return background_merge_task_.ContinueMergeInForeground(isolate, deadline);
+}
+
 MaybeHandle<SharedFunctionInfo> BackgroundDeserializeTask::Finish(
     Isolate* isolate, Handle<String> source,
     ScriptOriginOptions origin_options) {
@@ -2610,6 +2721,29 @@ bool Compiler::Compile(Isolate* isolate, Handle<SharedFunctionInfo> shared_info,
     return true;
   }
 
+  // Check if the GC kept a compressed copy of the flushed bytecode.
+  CompressedBytecodeStore* store = isolate->heap()->compressed_bytecode_store();
+  base::ElapsedTimer restore_timer;
+  if (v8_flags.log_function_events) restore_timer.Start();
+  if (store && store->TryRestore(isolate, shared_info,
+                                 flags.collect_source_positions())) {
+    *is_compiled_scope = shared_info->is_compiled_scope(isolate);
+    DCHECK(is_compiled_scope->is_compiled());
+    FinalizeRestoredCompilation(
+        isolate, script, flags, shared_info,
+        restore_timer.IsStarted() ? restore_timer.Elapsed()
+                                  : base::TimeDelta());
+    if (v8_flags.always_sparkplug &&
+        CanCompileWithBaseline(isolate, *shared_info)) {
+      Compiler::CompileSharedWithBaseline(isolate, shared_info,
+                                          Compiler::CLEAR_EXCEPTION,
+                                          is_compiled_scope);
+    }
+    RecordLazyCompilation(isolate, script, shared_info);
+    DCHECK(!isolate->has_exception());
+    return true;
+  }
+
   if (shared_info->HasUncompiledDataWithPreparseData()) {
     parse_info.set_consumed_preparse_data(ConsumedPreparseData::For(
         isolate,
@@ -2642,20 +2776,7 @@ bool Compiler::Compile(Isolate* isolate, Handle<SharedFunctionInfo> shared_info,
     CompileAllWithBaseline(isolate, finalize_unoptimized_compilation_data_list);
   }
 
-  if (script->produce_compile_hints()) {
-    // Log lazy funtion compilation.
-    Handle<ArrayList> list;
-    if (IsUndefined(script->compiled_lazy_function_positions())) {
-      constexpr int kInitialLazyFunctionPositionListSize = 100;
-      list = ArrayList::New(isolate, kInitialLazyFunctionPositionListSize);
-    } else {
-      list = handle(ArrayList::cast(script->compiled_lazy_function_positions()),
-                    isolate);
-    }
-    list = ArrayList::Add(isolate, list,
-                          Smi::FromInt(shared_info->StartPosition()));
-    script->set_compiled_lazy_function_positions(*list);
-  }
+  RecordLazyCompilation(isolate, script, shared_info);
 
   DCHECK(!isolate->has_exception());
   DCHECK(is_compiled_scope->is_compiled());
@@ -3557,6 +3678,41 @@ ScriptCompiler::InMemoryCacheResult CategorizeLookupResult(
              ? ScriptCompiler::InMemoryCacheResult::kPartial
              : ScriptCompiler::InMemoryCacheResult::kMiss;
 }
+
+bool CanUseProcessWideScriptCache(
+    Isolate* isolate, ScriptCompiler::CompileOptions compile_options,
+    NativesFlag natives) {
+  return v8_flags.process_wide_script_cache &&
+         compile_options == ScriptCompiler::kNoCompileOptions &&
+         natives == NOT_NATIVES_CODE && !isolate->debug()->is_active();
+}
+
+// Deserializes the script from the data another isolate left in the
+// process-wide script cache, if there is any.
+MaybeHandle<SharedFunctionInfo> LookupProcessWideScriptCache(
+    Isolate* isolate, Handle<String> source,
+    const ScriptDetails& script_details, MaybeHandle<Script> maybe_script) {
+  ProcessWideScriptCache::Data data = ProcessWideScriptCache::Get()->Lookup(
+      isolate, source, script_details.origin_options);
+  if (!data) return {};
+  AlignedCachedData cached_data(data->data(), static_cast<int>(data->size()));
+  Handle<SharedFunctionInfo> result;
+  if (!CodeSerializer::Deserialize(isolate, &cached_data, source,
+                                   script_details.origin_options, maybe_script)
+           .ToHandle(&result)) {
+    return {};
+  }
+  // The deserialized Script carries the details of the isolate that produced
+  // the data; replace them with ours.
+  DisallowGarbageCollection no_gc;
+  Tagged<Script> script = Script::cast(result->script());
+  script->set_name(ReadOnlyRoots(isolate).undefined_value());
+  script->set_line_offset(0);
+  script->set_column_offset(0);
+  script->set_host_defined_options(ReadOnlyRoots(isolate).empty_fixed_array());
+  SetScriptFieldsFromDetails(isolate, script, script_details, &no_gc);
+  return result;
+}
 }  // namespace
 
 MaybeHandle<SharedFunctionInfo> GetSharedFunctionInfoForScriptImpl(
@@ -3670,6 +3826,20 @@ MaybeHandle<SharedFunctionInfo> GetSharedFunctionInfoForScriptImpl(
         // Deserializer failed. Fall through to compile.
         compile_timer.set_consuming_code_cache_failed();
       }
+    } else if (CanUseProcessWideScriptCache(isolate, compile_options,
+                                            natives)) {
+      // Then check whether another isolate compiled the same script.
+      maybe_result = LookupProcessWideScriptCache(isolate, source,
+                                                  script_details, maybe_script);
+      Handle<SharedFunctionInfo> result;
+      if (maybe_result.ToHandle(&result)) {
+        is_compiled_scope = result->is_compiled_scope(isolate);
+        if (is_compiled_scope.is_compiled()) {
+          compilation_cache->PutScript(source, language_mode, result);
+        } else {
+          maybe_result = {};
+        }
+      }
     }
   }
 
@@ -3708,6 +3878,10 @@ MaybeHandle<SharedFunctionInfo> GetSharedFunctionInfoForScriptImpl(
     if (use_compilation_cache && maybe_result.ToHandle(&result)) {
       DCHECK(is_compiled_scope.is_compiled());
       compilation_cache->PutScript(source, language_mode, result);
+      if (CanUseProcessWideScriptCache(isolate, compile_options, natives)) {
+        ProcessWideScriptCache::Get()->Put(
+            isolate, source, script_details.origin_options, result);
+      }
     } else if (maybe_result.is_null() && natives != EXTENSION_CODE) {
       isolate->ReportPendingMessages();
     }
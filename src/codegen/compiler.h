@@ -32,6 +32,7 @@ namespace internal {
 // Forward declarations.
 class AlignedCachedData;
 class BackgroundCompileTask;
+class CompileHints;
 class IsCompiledScope;
 class OptimizedCompilationInfo;
 class ParseInfo;
@@ -632,6 +633,8 @@ class V8_EXPORT_PRIVATE BackgroundCompileTask {
 
   CompileHintCallback compile_hint_callback_ = nullptr;
   void* compile_hint_callback_data_ = nullptr;
+  // Hints from an earlier run, used without an embedder callback.
+  std::shared_ptr<const CompileHints> compile_hints_;
 };
 
 // Contains all data which needs to be transmitted between threads for
@@ -680,6 +683,13 @@ class V8_EXPORT_PRIVATE BackgroundDeserializeTask {
   // once.
   void MergeWithExistingScript();
 
+  // Does part of the main-thread work of the merge, until {deadline} has
+  // passed. Returns true if there is no main-thread merge work left apart from
+  // Finish. May only be called on the main thread, after
+  // MergeWithExistingScript.
+  bool ContinueMergeWithExistingScript(Isolate* isolate,
+                                       base::TimeTicks deadline);
+
   MaybeHandle<SharedFunctionInfo> Finish(Isolate* isolate,
                                          Handle<String> source,
                                          ScriptOriginOptions origin_options);
@@ -524,6 +524,7 @@ FUNCTION_REFERENCE(wasm_memory_fill, wasm::memory_fill_wrapper)
 FUNCTION_REFERENCE(wasm_float64_pow, wasm::float64_pow_wrapper)
 FUNCTION_REFERENCE(wasm_array_copy, wasm::array_copy_wrapper)
 FUNCTION_REFERENCE(wasm_array_fill, wasm::array_fill_wrapper)
+FUNCTION_REFERENCE(wasm_array_init_data, wasm::array_init_data_wrapper)
 FUNCTION_REFERENCE_WITH_TYPE(wasm_string_to_f64, wasm::flat_string_to_f64,
                              BUILTIN_FP_POINTER_CALL)
 int32_t (&futex_emulation_wake)(void*, uint32_t) = FutexEmulation::Wake;
@@ -259,12 +259,28 @@ bool LazyCompileDispatcher::FinishNow(Handle<SharedFunctionInfo> function) {
   }
 
   Job* job;
+  bool running_on_background;
 
   {
     base::MutexGuard lock(&mutex_);
     job = GetJobFor(function, lock);
+    running_on_background = job->is_running_on_background();
+  }
+
+  // If the job is already running on a background thread, let it finish at a
+  // higher priority and finalize other jobs instead of blocking right away.
+  const bool boost_priority =
+      running_on_background && job_handle_->UpdatePriorityEnabled();
+  if (boost_priority) job_handle_->UpdatePriority(TaskPriority::kUserBlocking);
+  while (Job* other_job = PopFinalizeJobWhileWaitingFor(job)) {
+    FinalizeJob(other_job);
+  }
+
+  {
+    base::MutexGuard lock(&mutex_);
     WaitForJobIfRunningOnBackground(job, lock);
   }
+  if (boost_priority) job_handle_->UpdatePriority(TaskPriority::kUserVisible);
 
   if (job->state == Job::State::kPendingToRunOnForeground) {
     job->task->RunOnMainThread(isolate_);
@@ -419,8 +435,8 @@ void LazyCompileDispatcher::DoBackgroundWork(JobDelegate* delegate) {
       base::MutexGuard lock(&mutex_);
 
       if (pending_background_jobs_.empty()) break;
-      job = pending_background_jobs_.back();
-      pending_background_jobs_.pop_back();
+      job = pending_background_jobs_.front();
+      pending_background_jobs_.pop_front();
       DCHECK_EQ(job->state, Job::State::kPending);
 
       job->state = Job::State::kRunning;
@@ -477,9 +493,8 @@ void LazyCompileDispatcher::DoBackgroundWork(JobDelegate* delegate) {
   // deleted.
 }
 
-LazyCompileDispatcher::Job* LazyCompileDispatcher::PopSingleFinalizeJob() {
-  base::MutexGuard lock(&mutex_);
-
+LazyCompileDispatcher::Job* LazyCompileDispatcher::PopSingleFinalizeJob(
+    const base::MutexGuard&) {
   if (finalizable_jobs_.empty()) return nullptr;
 
   Job* job = finalizable_jobs_.back();
@@ -495,14 +510,31 @@ LazyCompileDispatcher::Job* LazyCompileDispatcher::PopSingleFinalizeJob() {
   return job;
 }
 
+LazyCompileDispatcher::Job*
+LazyCompileDispatcher::PopFinalizeJobWhileWaitingFor(Job* job) {
+  base::MutexGuard lock(&mutex_);
+  // As long as {job} is running, it is not in the finalizable task queue.
+  if (!job->is_running_on_background()) return nullptr;
+  return PopSingleFinalizeJob(lock);
+}
+
 bool LazyCompileDispatcher::FinalizeSingleJob() {
-  Job* job = PopSingleFinalizeJob();
+  Job* job;
+  {
+    base::MutexGuard lock(&mutex_);
+    job = PopSingleFinalizeJob(lock);
+  }
   if (job == nullptr) return false;
 
   if (trace_compiler_dispatcher_) {
     PrintF("LazyCompileDispatcher: idle finalizing job\n");
   }
 
+  FinalizeJob(job);
+  return true;
+}
+
+void LazyCompileDispatcher::FinalizeJob(Job* job) {
   if (job->state == Job::State::kFinalizingNow) {
     HandleScope scope(isolate_);
     Compiler::FinalizeBackgroundCompileTask(job->task.get(), isolate_,
@@ -513,7 +545,6 @@ bool LazyCompileDispatcher::FinalizeSingleJob() {
   }
   job->state = Job::State::kFinalized;
   DeleteJob(job);
-  return true;
 }
 
 void LazyCompileDispatcher::DoIdleWork(double deadline_in_seconds) {
@@ -6,6 +6,7 @@
 #define V8_COMPILER_DISPATCHER_LAZY_COMPILE_DISPATCHER_H_
 
 #include <cstdint>
+#include <deque>
 #include <memory>
 #include <unordered_set>
 #include <utility>
@@ -55,8 +56,10 @@ class Zone;
 // LazyCompileDispatcher::jobs_ maintains the list of all
 // LazyCompilerDispatcherJobs the LazyCompileDispatcher knows about.
 //
-// LazyCompileDispatcher::pending_background_jobs_ contains the set of
+// LazyCompileDispatcher::pending_background_jobs_ contains the queue of
 // LazyCompilerDispatcherJobs that can be processed on a background thread.
+// Background threads take the jobs in the order they were enqueued, which is
+// roughly the order in which the functions are called during startup.
 //
 // LazyCompileDispatcher::running_background_jobs_ contains the set of
 // LazyCompilerDispatcherJobs that are currently being processed on a background
@@ -69,6 +72,11 @@ class Zone;
 // LazyCompileDispatcher::DoBackgroundWork advances one of the pending jobs,
 // and then spins of another idle task to potentially do the final step on the
 // main thread.
+//
+// LazyCompileDispatcher::FinishNow runs a pending job on the main thread. If
+// the job is already running on a background thread, the main thread raises
+// the priority of the background work and finalizes other jobs until the job
+// is done.
 class V8_EXPORT_PRIVATE LazyCompileDispatcher {
  public:
   using JobId = uintptr_t;
@@ -104,6 +112,7 @@ class V8_EXPORT_PRIVATE LazyCompileDispatcher {
   FRIEND_TEST(LazyCompileDispatcherTest, AsyncAbortAllPendingWorkerTask);
   FRIEND_TEST(LazyCompileDispatcherTest, AsyncAbortAllRunningWorkerTask);
   FRIEND_TEST(LazyCompileDispatcherTest, CompileMultipleOnBackgroundThread);
+  FRIEND_TEST(LazyCompileDispatcherTest, BackgroundJobsRunInEnqueueOrder);
 
   // JobTask for PostJob API.
   class JobTask;
@@ -151,9 +160,13 @@ class V8_EXPORT_PRIVATE LazyCompileDispatcher {
   void WaitForJobIfRunningOnBackground(Job* job, const base::MutexGuard&);
   Job* GetJobFor(Handle<SharedFunctionInfo> shared,
                  const base::MutexGuard&) const;
-  Job* PopSingleFinalizeJob();
+  Job* PopSingleFinalizeJob(const base::MutexGuard&);
+  // Pops a job to finalize while {job} is running on a background thread.
+  // Returns nullptr if {job} is done or there is no job to finalize.
+  Job* PopFinalizeJobWhileWaitingFor(Job* job);
   void ScheduleIdleTaskFromAnyThread(const base::MutexGuard&);
   bool FinalizeSingleJob();
+  void FinalizeJob(Job* job);
   void DoBackgroundWork(JobDelegate* delegate);
   void DoIdleWork(double deadline_in_seconds);
 
@@ -199,8 +212,8 @@ class V8_EXPORT_PRIVATE LazyCompileDispatcher {
   // True if an idle task is scheduled to be run.
   bool idle_task_scheduled_;
 
-  // The set of jobs that can be run on a background thread.
-  std::vector<Job*> pending_background_jobs_;
+  // The queue of jobs that can be run on a background thread.
+  std::deque<Job*> pending_background_jobs_;
 
   // The set of jobs that can be finalized on the main thread.
   std::vector<Job*> finalizable_jobs_;
@@ -68,6 +68,7 @@
 #include "src/profiler/profile-generator.h"
 #include "src/sandbox/testing.h"
 #include "src/snapshot/snapshot.h"
+#include "src/strings/mapped-file-string-resource.h"
 #include "src/tasks/cancelable-task.h"
 #include "src/utils/ostreams.h"
 #include "src/utils/utils.h"
@@ -495,22 +496,6 @@ static platform::tracing::TraceConfig* CreateTraceConfigFromJSON(
 
 }  // namespace tracing
 
-class ExternalOwningOneByteStringResource
-    : public String::ExternalOneByteStringResource {
- public:
-  ExternalOwningOneByteStringResource() = default;
-  ExternalOwningOneByteStringResource(
-      std::unique_ptr<base::OS::MemoryMappedFile> file)
-      : file_(std::move(file)) {}
-  const char* data() const override {
-    return static_cast<char*>(file_->memory());
-  }
-  size_t length() const override { return file_->size(); }
-
- private:
-  std::unique_ptr<base::OS::MemoryMappedFile> file_;
-};
-
 // static variables:
 CounterMap* Shell::counter_map_;
 base::SharedMutex Shell::counter_mutex_;
@@ -4074,8 +4059,9 @@ MaybeLocal<String> Shell::ReadFile(Isolate* isolate, const char* name,
   int size = static_cast<int>(file->size());
   char* chars = static_cast<char*>(file->memory());
   if (i::v8_flags.use_external_strings && i::String::IsAscii(chars, size)) {
+    file->DiscardResidentPages();
     String::ExternalOneByteStringResource* resource =
-        new ExternalOwningOneByteStringResource(std::move(file));
+        new i::MappedFileStringResource(std::move(file));
     return String::NewExternalOneByte(isolate, resource);
   }
   return String::NewFromUtf8(isolate, chars, NewStringType::kNormal, size);
@@ -1888,6 +1888,8 @@ void JSRegExp::JSRegExpVerify(Isolate* isolate) {
       CHECK_EQ(arr->get(JSRegExp::kIrregexpTicksUntilTierUpIndex),
                uninitialized);
       CHECK_EQ(arr->get(JSRegExp::kIrregexpBacktrackLimit), uninitialized);
+      CHECK_EQ(arr->get(JSRegExp::kIrregexpRequiredLiteralIndex),
+               uninitialized);
       break;
     }
     case JSRegExp::IRREGEXP: {
@@ -1928,6 +1930,11 @@ void JSRegExp::JSRegExpVerify(Isolate* isolate) {
       CHECK(IsSmi(arr->get(JSRegExp::kIrregexpMaxRegisterCountIndex)));
       CHECK(IsSmi(arr->get(JSRegExp::kIrregexpTicksUntilTierUpIndex)));
       CHECK(IsSmi(arr->get(JSRegExp::kIrregexpBacktrackLimit)));
+      Tagged<Object> required_literal =
+          arr->get(JSRegExp::kIrregexpRequiredLiteralIndex);
+      CHECK((IsSmi(required_literal) &&
+             Smi::ToInt(required_literal) == JSRegExp::kUninitializedValue) ||
+            IsSeqOneByteString(required_literal));
       break;
     }
     default:
@@ -2458,6 +2458,10 @@ void WasmModuleObject::WasmModuleObjectPrint(std::ostream& os) {
   os << "\n - module: " << module();
   os << "\n - native module: " << native_module();
   os << "\n - script: " << Brief(script());
+  os << "\n - import names: " << Brief(import_names());
+  os << "\n - export names: " << Brief(export_names());
+  os << "\n - untagged globals template: "
+     << Brief(untagged_globals_template());
   os << "\n";
 }
 
@@ -33,6 +33,7 @@
 #include "src/builtins/constants-table-builder.h"
 #include "src/codegen/assembler-inl.h"
 #include "src/codegen/compilation-cache.h"
+#include "src/codegen/compile-hints.h"
 #include "src/codegen/flush-instruction-cache.h"
 #include "src/common/assert-scope.h"
 #include "src/common/globals.h"
@@ -3240,6 +3241,13 @@ void Isolate::UnregisterManagedPtrDestructor(ManagedPtrDestructor* destructor) {
 }
 
 #if V8_ENABLE_WEBASSEMBLY
+wasm::StackPool* Isolate::wasm_stack_pool() {
+  if (!wasm_stack_pool_) {
+    wasm_stack_pool_ = std::make_unique<wasm::StackPool>(counters());
+  }
+  return wasm_stack_pool_.get();
+}
+
 bool Isolate::IsOnCentralStack(Address addr) {
 #ifdef USE_SIMULATOR
   auto simulator_stack = Simulator::current(this)->GetCurrentStackView();
@@ -3882,6 +3890,11 @@ void Isolate::Deinit() {
     lazy_compile_dispatcher_.reset();
   }
 
+  if (compile_hints_recorder_) {
+    compile_hints_recorder_->WriteToFile(v8_flags.compile_hints_output);
+    compile_hints_recorder_.reset();
+  }
+
   // At this point there are no more background threads left in this isolate.
   heap_.safepoint()->AssertMainThreadIsOnlyThread();
 
@@ -4646,6 +4659,12 @@ bool Isolate::Init(SnapshotData* startup_snapshot_data,
     lazy_compile_dispatcher_ = std::make_unique<LazyCompileDispatcher>(
         this, V8::GetCurrentPlatform(), v8_flags.stack_size);
   }
+  if (v8_flags.compile_hints_output != nullptr) {
+    compile_hints_recorder_ = std::make_unique<CompileHintsRecorder>();
+  }
+  if (v8_flags.compile_hints_input != nullptr) {
+    compile_hints_ = CompileHints::ReadFromFile(v8_flags.compile_hints_input);
+  }
 #ifdef V8_ENABLE_SPARKPLUG
   baseline_batch_compiler_ = new baseline::BaselineBatchCompiler(this);
 #endif  // V8_ENABLE_SPARKPLUG
@@ -116,6 +116,8 @@ class Logger;
 class CodeTracer;
 class CommonFrame;
 class CompilationCache;
+class CompileHints;
+class CompileHintsRecorder;
 class CompilationStatistics;
 class Counters;
 class Debug;
@@ -182,8 +184,9 @@ class Recorder;
 }  // namespace metrics
 
 namespace wasm {
+class StackPool;
 class WasmCodeLookupCache;
-}
+}  // namespace wasm
 
 #define RETURN_FAILURE_IF_EXCEPTION(isolate)         \
   do {                                               \
@@ -1879,6 +1882,15 @@ class V8_EXPORT_PRIVATE Isolate final : private HiddenFactory {
     return lazy_compile_dispatcher_.get();
   }
 
+  // The recorder is only set with --compile-hints-output, and the hints only
+  // with --compile-hints-input.
+  CompileHintsRecorder* compile_hints_recorder() const {
+    return compile_hints_recorder_.get();
+  }
+  const std::shared_ptr<const CompileHints>& compile_hints() const {
+    return compile_hints_;
+  }
+
   bool IsInAnyContext(Tagged<Object> object, uint32_t index);
 
   void ClearKeptObjects();
@@ -2153,6 +2165,11 @@ class V8_EXPORT_PRIVATE Isolate final : private HiddenFactory {
 #ifdef V8_ENABLE_WEBASSEMBLY
   bool IsOnCentralStack();
   wasm::StackMemory*& wasm_stacks() { return wasm_stacks_; }
+  wasm::StackPool* wasm_stack_pool();
+  // Returns the stack pool, or nullptr if no stack was allocated yet.
+  wasm::StackPool* wasm_stack_pool_if_allocated() const {
+    return wasm_stack_pool_.get();
+  }
   // Update the thread local's Stack object so that it is aware of the new stack
   // start and the inactive stacks.
   void UpdateCentralStackInfo();
@@ -2517,6 +2534,8 @@ class V8_EXPORT_PRIVATE Isolate final : private HiddenFactory {
   Zone* compiler_zone_ = nullptr;
 
   std::unique_ptr<LazyCompileDispatcher> lazy_compile_dispatcher_;
+  std::unique_ptr<CompileHintsRecorder> compile_hints_recorder_;
+  std::shared_ptr<const CompileHints> compile_hints_;
 #ifdef V8_ENABLE_SPARKPLUG
   baseline::BaselineBatchCompiler* baseline_batch_compiler_ = nullptr;
 #endif  // V8_ENABLE_SPARKPLUG
@@ -2705,6 +2724,7 @@ class V8_EXPORT_PRIVATE Isolate final : private HiddenFactory {
 #ifdef V8_ENABLE_WEBASSEMBLY
   wasm::WasmCodeLookupCache* wasm_code_look_up_cache_ = nullptr;
   wasm::StackMemory* wasm_stacks_ = nullptr;
+  std::unique_ptr<wasm::StackPool> wasm_stack_pool_;
 #endif
 
   // Enables the host application to provide a mechanism for recording a
@@ -1434,6 +1434,9 @@ DEFINE_DEBUG_BOOL(trace_wasm_stack_switching, false,
                   "trace wasm stack switching")
 DEFINE_INT(wasm_stack_switching_stack_size, V8_DEFAULT_STACK_SIZE_KB,
            "default size of stacks for wasm stack-switching (in kB)")
+DEFINE_INT(wasm_stack_pool_size, 4 * MB / KB,
+           "maximum size of unused wasm stack-switching stacks to keep for "
+           "reuse (in kB)")
 DEFINE_BOOL(liftoff, true,
             "enable Liftoff, the baseline compiler for WebAssembly")
 DEFINE_BOOL(liftoff_only, false,
@@ -1860,6 +1863,15 @@ DEFINE_BOOL(flush_baseline_code, false,
 DEFINE_BOOL(flush_bytecode, true,
             "flush of bytecode when it has not been executed recently")
 DEFINE_INT(bytecode_old_age, 6, "number of gcs before we flush code")
+DEFINE_BOOL(compress_flushed_bytecode, false,
+            "keep a compressed copy of flushed bytecode to restore it from "
+            "instead of recompiling")
+DEFINE_INT(compressed_bytecode_max_age, 30,
+           "number of gcs before a compressed copy of flushed bytecode is "
+           "dropped")
+DEFINE_SIZE_T(compressed_bytecode_max_size, 16,
+              "maximum size of the compressed copies of flushed bytecode (in "
+              "MB), beyond which the oldest copies are dropped")
 DEFINE_BOOL(flush_code_based_on_time, false,
             "Use time-base code flushing instead of age.")
 DEFINE_BOOL(flush_code_based_on_tab_visibility, false,
@@ -2097,6 +2109,12 @@ DEFINE_BOOL(lazy_streaming, true,
 DEFINE_BOOL(max_lazy, false, "ignore eager compilation hints")
 DEFINE_IMPLICATION(max_lazy, lazy)
 DEFINE_BOOL(compile_hints_magic, false, "enable magic compile hints comments")
+DEFINE_STRING(compile_hints_output, nullptr,
+              "record the functions compiled lazily and write them as compile "
+              "hints to the given file when the isolate is torn down")
+DEFINE_STRING(compile_hints_input, nullptr,
+              "eagerly compile the functions listed in the given compile "
+              "hints file when streaming scripts")
 DEFINE_BOOL(trace_opt, false, "trace optimized compilation")
 DEFINE_BOOL(trace_opt_verbose, false,
             "extra verbose optimized compilation tracing")
@@ -2126,6 +2144,11 @@ DEFINE_BOOL(external_reference_stats, false,
 
 // compilation-cache.cc
 DEFINE_BOOL(compilation_cache, true, "enable compilation cache")
+DEFINE_BOOL(process_wide_script_cache, false,
+            "share code cache data for top-level scripts between all isolates "
+            "in the process")
+DEFINE_SIZE_T(process_wide_script_cache_size, 64,
+              "maximum size of the process-wide script cache (in MB)")
 
 DEFINE_BOOL(cache_prototype_transitions, true, "cache prototype transitions")
 
@@ -2144,6 +2167,14 @@ DEFINE_BOOL(parallel_compile_tasks_for_lazy, false,
             "spawn parallel compile tasks for all lazily compiled functions")
 DEFINE_IMPLICATION(parallel_compile_tasks_for_lazy, lazy_compile_dispatcher)
 
+// parallel-preparser.cc
+DEFINE_BOOL(parallel_preparse, false,
+            "preparse top-level functions of large scripts on worker threads")
+DEFINE_INT(parallel_preparse_min_source_size, 512,
+           "minimum script size (in KB) for parallel preparsing")
+DEFINE_UINT(parallel_preparse_max_threads, 0,
+            "max threads for parallel preparsing (0 for unbounded)")
+
 // cpu-profiler.cc
 DEFINE_INT(cpu_profiler_sampling_interval, 1000,
            "CPU profiler sampling interval in microseconds")
@@ -2378,6 +2409,9 @@ DEFINE_BOOL(serialization_statistics, false,
             "Collect statistics on serialized objects.")
 // Regexp
 DEFINE_BOOL(regexp_optimization, true, "generate optimized regexp code")
+DEFINE_BOOL(regexp_required_literal_prefilter, true,
+            "skip regexp matching if the subject lacks a literal that every "
+            "match contains")
 DEFINE_BOOL(regexp_interpret_all, false, "interpret all regexp code")
 #ifdef V8_TARGET_BIG_ENDIAN
 #define REGEXP_PEEPHOLE_OPTIMIZATION_BOOL false
@@ -2848,6 +2882,7 @@ DEFINE_NEG_IMPLICATION(predictable, stress_concurrent_inlining)
 DEFINE_NEG_IMPLICATION(predictable, lazy_compile_dispatcher)
 DEFINE_NEG_IMPLICATION(predictable, parallel_compile_tasks_for_eager_toplevel)
 DEFINE_NEG_IMPLICATION(predictable, parallel_compile_tasks_for_lazy)
+DEFINE_NEG_IMPLICATION(predictable, parallel_preparse)
 #ifdef V8_ENABLE_MAGLEV
 DEFINE_NEG_IMPLICATION(predictable, maglev_deopt_data_on_background)
 DEFINE_NEG_IMPLICATION(predictable, maglev_build_code_on_background)
@@ -2875,6 +2910,7 @@ DEFINE_NEG_IMPLICATION(single_threaded, lazy_compile_dispatcher)
 DEFINE_NEG_IMPLICATION(single_threaded,
                        parallel_compile_tasks_for_eager_toplevel)
 DEFINE_NEG_IMPLICATION(single_threaded, parallel_compile_tasks_for_lazy)
+DEFINE_NEG_IMPLICATION(single_threaded, parallel_preparse)
 #ifdef V8_ENABLE_MAGLEV
 DEFINE_NEG_IMPLICATION(single_threaded, maglev_deopt_data_on_background)
 DEFINE_NEG_IMPLICATION(single_threaded, maglev_build_code_on_background)
@@ -0,0 +1,221 @@
+// Copyright 2024 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#include "src/heap/compressed-bytecode-store.h"
+
+#include "src/execution/isolate.h"
+#include "src/heap/factory.h"
+#include "src/heap/heap.h"
+#include "src/interpreter/bytecode-register.h"
+#include "src/objects/bytecode-array-inl.h"
+#include "src/objects/fixed-array-inl.h"
+#include "src/objects/script-inl.h"
+#include "src/objects/shared-function-info-inl.h"
+#include "src/objects/visitors.h"
+#include "src/utils/memcopy.h"
+
+#ifdef V8_USE_ZLIB
+#include "third_party/zlib/google/compression_utils_portable.h"
+#endif  // V8_USE_ZLIB
+
+namespace v8 {
+namespace internal {
+
+namespace {
+
+std::vector<uint8_t> Compress(const std::vector<uint8_t>& data) {
+#ifdef V8_USE_ZLIB
+  // Compression happens in the atomic pause of the GC, so favor speed.
+  uLongf compressed_size = compressBound(static_cast<uLong>(data.size()));
+  std::vector<uint8_t> compressed(compressed_size);
+  CHECK_EQ(zlib_internal::CompressHelper(
+               zlib_internal::ZRAW, compressed.data(), &compressed_size,
+               data.data(), static_cast<uLong>(data.size()), Z_BEST_SPEED,
+               nullptr, nullptr),
+           Z_OK);
+  compressed.resize(compressed_size);
+  compressed.shrink_to_fit();
+  return compressed;
+#else
+  return data;
+#endif  // V8_USE_ZLIB
+}
+
+std::vector<uint8_t> Uncompress(const std::vector<uint8_t>& data,
+                                uint32_t uncompressed_size) {
+#ifdef V8_USE_ZLIB
+  std::vector<uint8_t> uncompressed(uncompressed_size);
+  uLongf size = uncompressed_size;
+  CHECK_EQ(zlib_internal::UncompressHelper(
+               zlib_internal::ZRAW, uncompressed.data(), &size, data.data(),
+               static_cast<uLong>(data.size())),
+           Z_OK);
+  CHECK_EQ(uncompressed_size, size);
+  return uncompressed;
+#else
+  DCHECK_EQ(uncompressed_size, data.size());
+  return data;
+#endif  // V8_USE_ZLIB
+}
+
+}  // namespace
+
+void CompressedBytecodeStore::Add(Tagged<SharedFunctionInfo> shared,
+                                  Tagged<BytecodeArray> bytecode) {
+  DisallowGarbageCollection no_gc;
+  if (!IsScript(shared->script())) return;
+  Key key(Script::cast(shared->script())->id(), shared->function_literal_id());
+  auto it = entries_.find(key);
+  if (it != entries_.end()) {
+    // Two functions with the same literal id (see CloneSharedFunctionInfo)
+    // cannot be told apart, so keep neither.
+    Remove(it);
+    return;
+  }
+
+  Entry entry;
+  entry.constant_pool = bytecode->constant_pool().ptr();
+  entry.feedback_metadata = shared->feedback_metadata().ptr();
+  entry.frame_size = bytecode->frame_size();
+  entry.parameter_count = bytecode->parameter_count();
+  interpreter::Register incoming_register =
+      bytecode->incoming_new_target_or_generator_register();
+  entry.incoming_new_target_or_generator_register =
+      incoming_register.is_valid() ? incoming_register.ToOperand() : 0;
+  entry.bytecode_length = bytecode->length();
+  Tagged<TrustedByteArray> handler_table = bytecode->handler_table();
+  entry.handler_table_length = handler_table->length();
+  Tagged<Object> source_position_table =
+      bytecode->raw_source_position_table(kAcquireLoad);
+  entry.source_position_table_length =
+      IsByteArray(source_position_table)
+          ? ByteArray::cast(source_position_table)->length()
+          : -1;
+
+  std::vector<uint8_t> data(
+      reinterpret_cast<uint8_t*>(bytecode->GetFirstBytecodeAddress()),
+      reinterpret_cast<uint8_t*>(bytecode->GetFirstBytecodeAddress()) +
+          entry.bytecode_length);
+  data.insert(data.end(), handler_table->begin(),
+              handler_table->begin() + entry.handler_table_length);
+  if (entry.source_position_table_length > 0) {
+    Tagged<ByteArray> table = ByteArray::cast(source_position_table);
+    data.insert(data.end(), table->begin(),
+                table->begin() + entry.source_position_table_length);
+  }
+  entry.uncompressed_size = static_cast<uint32_t>(data.size());
+  entry.data = Compress(data);
+
+  size_in_bytes_ += entry.data.size();
+  entry.key_by_age = keys_by_age_.insert(keys_by_age_.end(), key);
+  entries_.emplace(key, std::move(entry));
+
+  // Entries never become younger, so the front of {keys_by_age_} is the
+  // oldest.
+  const size_t budget = v8_flags.compressed_bytecode_max_size * MB;
+  while (size_in_bytes_ > budget) {
+    Remove(entries_.find(keys_by_age_.front()));
+  }
+}
+
+bool CompressedBytecodeStore::TryRestore(Isolate* isolate,
+                                         Handle<SharedFunctionInfo> shared,
+                                         bool needs_source_positions) {
+  if (entries_.empty() || !IsScript(shared->script())) return false;
+  auto it = entries_.find(
+      Key(Script::cast(shared->script())->id(), shared->function_literal_id()));
+  if (it == entries_.end()) return false;
+
+  // Bytecode for the debugger or for code coverage differs from the
+  // bytecode that was flushed.
+  if (isolate->debug()->is_active() || isolate->is_block_code_coverage() ||
+      (needs_source_positions &&
+       it->second.source_position_table_length < 0) ||
+      it->second.parameter_count !=
+          shared->internal_formal_parameter_count_with_receiver()) {
+    Remove(it);
+    return false;
+  }
+
+  // Take the entry out before allocating, which can run the GC. The handles
+  // keep the constants alive from here on.
+  Handle<FixedArray> constant_pool(
+      FixedArray::cast(Tagged<Object>(it->second.constant_pool)), isolate);
+  Handle<FeedbackMetadata> feedback_metadata(
+      FeedbackMetadata::cast(Tagged<Object>(it->second.feedback_metadata)),
+      isolate);
+  const Entry entry = std::move(it->second);
+  size_in_bytes_ -= entry.data.size();
+  keys_by_age_.erase(entry.key_by_age);
+  entries_.erase(it);
+  hits_++;
+
+  std::vector<uint8_t> data = Uncompress(entry.data, entry.uncompressed_size);
+  const uint8_t* bytecodes = data.data();
+  const uint8_t* handler_table_data = bytecodes + entry.bytecode_length;
+  const uint8_t* source_positions =
+      handler_table_data + entry.handler_table_length;
+
+  Factory* factory = isolate->factory();
+  Handle<TrustedByteArray> handler_table =
+      factory->NewTrustedByteArray(entry.handler_table_length);
+  CopyBytes(handler_table->begin(), handler_table_data,
+            entry.handler_table_length);
+  Handle<BytecodeArray> bytecode = factory->NewBytecodeArray(
+      entry.bytecode_length, bytecodes, entry.frame_size,
+      entry.parameter_count, constant_pool, handler_table);
+  if (entry.incoming_new_target_or_generator_register != 0) {
+    bytecode->set_incoming_new_target_or_generator_register(
+        interpreter::Register::FromOperand(
+            entry.incoming_new_target_or_generator_register));
+  }
+  if (entry.source_position_table_length >= 0) {
+    Handle<ByteArray> table =
+        factory->NewByteArray(entry.source_position_table_length);
+    CopyBytes(table->begin(), source_positions,
+              entry.source_position_table_length);
+    bytecode->set_source_position_table(*table, kReleaseStore);
+  }
+
+  shared->set_feedback_metadata(*feedback_metadata, kReleaseStore);
+  shared->set_age(0);
+  shared->set_bytecode_array(*bytecode);
+  return true;
+}
+
+void CompressedBytecodeStore::Age() {
+  for (auto it = entries_.begin(); it != entries_.end();) {
+    auto current = it++;
+    if (++current->second.age > v8_flags.compressed_bytecode_max_age) {
+      Remove(current);
+    }
+  }
+}
+
+void CompressedBytecodeStore::Clear() {
+  evictions_ += entries_.size();
+  entries_.clear();
+  keys_by_age_.clear();
+  size_in_bytes_ = 0;
+}
+
+void CompressedBytecodeStore::Iterate(RootVisitor* v) {
+  for (auto& [key, entry] : entries_) {
+    v->VisitRootPointer(Root::kCodeFlusher, nullptr,
+                        FullObjectSlot(&entry.constant_pool));
+    v->VisitRootPointer(Root::kCodeFlusher, nullptr,
+                        FullObjectSlot(&entry.feedback_metadata));
+  }
+}
+
+void CompressedBytecodeStore::Remove(EntryMap::iterator it) {
+  DCHECK_GE(size_in_bytes_, it->second.data.size());
+  size_in_bytes_ -= it->second.data.size();
+  evictions_++;
+  keys_by_age_.erase(it->second.key_by_age);
+  entries_.erase(it);
+}
+
+}  // namespace internal
+}  // namespace v8
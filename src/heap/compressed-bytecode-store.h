@@ -0,0 +1,102 @@
+// Copyright 2024 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#ifndef V8_HEAP_COMPRESSED_BYTECODE_STORE_H_
+#define V8_HEAP_COMPRESSED_BYTECODE_STORE_H_
+
+#include <cstdint>
+#include <list>
+#include <unordered_map>
+#include <vector>
+
+#include "src/base/functional.h"
+#include "src/common/globals.h"
+#include "src/handles/handles.h"
+
+namespace v8 {
+namespace internal {
+
+class BytecodeArray;
+class RootVisitor;
+class SharedFunctionInfo;
+
+// A tier between flushed and live bytecode (--compress-flushed-bytecode).
+// When the GC flushes the bytecode of a function, the bytecodes, handler
+// table and source position table are compressed into an off-heap copy, and
+// the constant pool and feedback metadata are kept alive as roots of this
+// store (the marker keeps them alive in the GC that flushes the bytecode). If
+// the function runs again, the BytecodeArray is restored from the copy
+// instead of reparsing and recompiling the function. Copies that are not used
+// within --compressed-bytecode-max-age full GCs are dropped, and so are the
+// oldest copies when all of them take more than --compressed-bytecode-max-size.
+//
+// Copies are keyed by script id and function literal id, which identify the
+// function across the flush.
+class CompressedBytecodeStore final {
+ public:
+  CompressedBytecodeStore() = default;
+  CompressedBytecodeStore(const CompressedBytecodeStore&) = delete;
+  CompressedBytecodeStore& operator=(const CompressedBytecodeStore&) = delete;
+
+  // Called by the GC, before flushing {bytecode} from {shared}. The constant
+  // pool of {bytecode} has to be live.
+  void Add(Tagged<SharedFunctionInfo> shared, Tagged<BytecodeArray> bytecode);
+
+  // Restores the bytecode of {shared} from its compressed copy, if there is
+  // one and it is usable. Returns whether {shared} is compiled.
+  bool TryRestore(Isolate* isolate, Handle<SharedFunctionInfo> shared,
+                  bool needs_source_positions);
+
+  // Called by the GC once per full GC. Drops the copies that were not used
+  // for --compressed-bytecode-max-age full GCs.
+  void Age();
+
+  // Drops all copies.
+  void Clear();
+
+  void Iterate(RootVisitor* v);
+
+  size_t size_in_bytes() const { return size_in_bytes_; }
+  size_t hits() const { return hits_; }
+  size_t evictions() const { return evictions_; }
+
+ private:
+  using Key = std::pair<int, int>;
+
+  struct Entry {
+    // Roots.
+    Address constant_pool;
+    Address feedback_metadata;
+
+    int32_t frame_size;
+    int32_t parameter_count;
+    int32_t incoming_new_target_or_generator_register;
+    int bytecode_length;
+    int handler_table_length;
+    // -1 if there was no source position table.
+    int source_position_table_length;
+    uint32_t uncompressed_size;
+    std::vector<uint8_t> data;
+    int age = 0;
+    // The position of the key in {keys_by_age_}.
+    std::list<Key>::iterator key_by_age;
+  };
+
+  using EntryMap = std::unordered_map<Key, Entry, base::hash<Key>>;
+
+  // Drops an entry that was not used.
+  void Remove(EntryMap::iterator it);
+
+  EntryMap entries_;
+  // The keys of {entries_}, oldest first.
+  std::list<Key> keys_by_age_;
+  size_t size_in_bytes_ = 0;
+  size_t hits_ = 0;
+  size_t evictions_ = 0;
+};
+
+}  // namespace internal
+}  // namespace v8
+
+#endif  // V8_HEAP_COMPRESSED_BYTECODE_STORE_H_
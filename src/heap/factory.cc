@@ -3846,6 +3846,7 @@ void Factory::SetRegExpIrregexpData(DirectHandle<JSRegExp> regexp,
   store->set(JSRegExp::kIrregexpCaptureNameMapIndex, uninitialized);
   store->set(JSRegExp::kIrregexpTicksUntilTierUpIndex, ticks_until_tier_up);
   store->set(JSRegExp::kIrregexpBacktrackLimit, Smi::FromInt(backtrack_limit));
+  store->set(JSRegExp::kIrregexpRequiredLiteralIndex, uninitialized);
   regexp->set_data(store);
 }
 
@@ -3870,6 +3871,7 @@ void Factory::SetRegExpExperimentalData(DirectHandle<JSRegExp> regexp,
   store->set(JSRegExp::kIrregexpCaptureNameMapIndex, uninitialized);
   store->set(JSRegExp::kIrregexpTicksUntilTierUpIndex, uninitialized);
   store->set(JSRegExp::kIrregexpBacktrackLimit, uninitialized);
+  store->set(JSRegExp::kIrregexpRequiredLiteralIndex, uninitialized);
   regexp->set_data(store);
 }
 
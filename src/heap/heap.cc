@@ -47,6 +47,7 @@
 #include "src/heap/code-stats.h"
 #include "src/heap/collection-barrier.h"
 #include "src/heap/combined-heap.h"
+#include "src/heap/compressed-bytecode-store.h"
 #include "src/heap/concurrent-marking.h"
 #include "src/heap/cppgc-js/cpp-heap.h"
 #include "src/heap/ephemeron-remembered-set.h"
@@ -114,6 +115,7 @@
 #include "src/snapshot/embedded/embedded-data.h"
 #include "src/snapshot/serializer-deserializer.h"
 #include "src/snapshot/snapshot.h"
+#include "src/strings/mapped-file-string-resource.h"
 #include "src/strings/string-stream.h"
 #include "src/strings/unicode-inl.h"
 #include "src/tracing/trace-event.h"
@@ -1603,6 +1605,11 @@ void Heap::CollectAllAvailableGarbage(GarbageCollectionReason gc_reason) {
   isolate()->AbortConcurrentOptimization(BlockingBehavior::kDontBlock);
   isolate()->ClearSerializerData();
   isolate()->compilation_cache()->Clear();
+  if (gc_reason == GarbageCollectionReason::kLowMemoryNotification &&
+      v8_flags.process_wide_script_cache) {
+    ProcessWideScriptCache::Get()->Clear();
+  }
+  if (compressed_bytecode_store_) compressed_bytecode_store_->Clear();
 
   current_gc_flags_ =
       GCFlag::kReduceMemoryFootprint |
@@ -4246,6 +4253,7 @@ void Heap::MemoryPressureNotification(MemoryPressureLevel level,
 
 void Heap::EagerlyFreeExternalMemory() {
   CompleteArrayBufferSweeping(this);
+  MappedFileStringResource::DiscardAllResidentPages();
 }
 
 void Heap::AddNearHeapLimitCallback(v8::NearHeapLimitCallback callback,
@@ -4788,6 +4796,10 @@ void Heap::IterateRoots(RootVisitor* v, base::EnumSet<SkipRoot> options,
     }
     v->Synchronize(VisitorSynchronization::kStrongRoots);
 
+    // Iterate over the constants of flushed bytecode that is kept compressed.
+    if (compressed_bytecode_store_) compressed_bytecode_store_->Iterate(v);
+    v->Synchronize(VisitorSynchronization::kCodeFlusher);
+
     // Iterate over the startup and shared heap object caches unless
     // serializing or deserializing.
     SerializerDeserializer::IterateStartupObjectCache(isolate_, v);
@@ -5739,6 +5751,9 @@ void Heap::SetUpSpaces(LinearAllocationArea& new_allocation_info,
   gc_idle_time_handler_.reset(new GCIdleTimeHandler());
   memory_measurement_.reset(new MemoryMeasurement(isolate()));
   if (v8_flags.memory_reducer) memory_reducer_.reset(new MemoryReducer(this));
+  if (v8_flags.compress_flushed_bytecode) {
+    compressed_bytecode_store_.reset(new CompressedBytecodeStore());
+  }
   if (V8_UNLIKELY(TracingFlags::is_gc_stats_enabled())) {
     live_object_stats_.reset(new ObjectStats(this));
     dead_object_stats_.reset(new ObjectStats(this));
@@ -6073,6 +6088,7 @@ void Heap::TearDown() {
     memory_reducer_->TearDown();
     memory_reducer_.reset();
   }
+  compressed_bytecode_store_.reset();
 
   live_object_stats_.reset();
   dead_object_stats_.reset();
@@ -86,6 +86,7 @@ class Boolean;
 class CodeLargeObjectSpace;
 class CodeRange;
 class CollectionBarrier;
+class CompressedBytecodeStore;
 class ConcurrentMarking;
 class CppHeap;
 class EphemeronRememberedSet;
@@ -1879,6 +1880,11 @@ class Heap final {
 
   MemoryReducer* memory_reducer() { return memory_reducer_.get(); }
 
+  // Only exists with --compress-flushed-bytecode.
+  CompressedBytecodeStore* compressed_bytecode_store() {
+    return compressed_bytecode_store_.get();
+  }
+
   // For some webpages RAIL mode does not switch from PERFORMANCE_LOAD.
   // This constant limits the effect of load RAIL mode on GC.
   // The value is arbitrary and chosen as the largest load time observed in
@@ -2230,6 +2236,7 @@ class Heap final {
   std::unique_ptr<GCIdleTimeHandler> gc_idle_time_handler_;
   std::unique_ptr<MemoryMeasurement> memory_measurement_;
   std::unique_ptr<MemoryReducer> memory_reducer_;
+  std::unique_ptr<CompressedBytecodeStore> compressed_bytecode_store_;
   std::unique_ptr<ObjectStats> live_object_stats_;
   std::unique_ptr<ObjectStats> dead_object_stats_;
   std::unique_ptr<MinorGCJob> minor_gc_job_;
@@ -29,6 +29,7 @@
 #include "src/handles/global-handles.h"
 #include "src/heap/array-buffer-sweeper.h"
 #include "src/heap/basic-memory-chunk.h"
+#include "src/heap/compressed-bytecode-store.h"
 #include "src/heap/concurrent-marking.h"
 #include "src/heap/ephemeron-remembered-set.h"
 #include "src/heap/evacuation-allocator-inl.h"
@@ -2995,6 +2996,18 @@ void MarkCompactCollector::FlushBytecodeFromSFI(
     Tagged<SharedFunctionInfo> shared_info) {
   DCHECK(shared_info->HasBytecodeArray());
 
+  // Keep a compressed copy of the bytecode if the marker kept its constant
+  // pool alive.
+  if (CompressedBytecodeStore* store = heap_->compressed_bytecode_store()) {
+    Tagged<BytecodeArray> bytecode_array =
+        shared_info->GetBytecodeArray(heap_->isolate());
+    Tagged<FixedArray> constant_pool = bytecode_array->constant_pool();
+    if (!ShouldMarkObject(constant_pool) ||
+        marking_state_->IsMarked(constant_pool)) {
+      store->Add(shared_info, bytecode_array);
+    }
+  }
+
   // Retain objects required for uncompiled data.
   Tagged<String> inferred_name = shared_info->inferred_name();
   int start_position = shared_info->StartPosition();
@@ -3062,6 +3075,9 @@ void MarkCompactCollector::FlushBytecodeFromSFI(
 void MarkCompactCollector::ProcessOldCodeCandidates() {
   DCHECK(v8_flags.flush_bytecode || v8_flags.flush_baseline_code ||
          weak_objects_.code_flushing_candidates.IsEmpty());
+  if (CompressedBytecodeStore* store = heap_->compressed_bytecode_store()) {
+    store->Age();
+  }
   Tagged<SharedFunctionInfo> flushing_candidate;
   int number_of_flushed_sfis = 0;
   while (local_weak_objects()->code_flushing_candidates_local.Pop(
@@ -311,6 +311,21 @@ int MarkingVisitorBase<ConcreteVisitor>::VisitSharedFunctionInfo(
   } else {
     // In other cases, record as a flushing candidate since we have old
     // bytecode.
+    if (V8_UNLIKELY(v8_flags.compress_flushed_bytecode)) {
+      // The constant pool outlives the flushed bytecode in the
+      // CompressedBytecodeStore.
+      Tagged<Object> data = shared_info->GetData(heap_->isolate());
+      if (IsCode(data)) {
+        data = Code::cast(data)->bytecode_or_interpreter_data(heap_->isolate());
+      }
+      if (IsBytecodeArray(data)) {
+        Tagged<BytecodeArray> bytecode = BytecodeArray::cast(data);
+        Tagged<FixedArray> constant_pool = bytecode->constant_pool();
+        if (ShouldMarkObject(constant_pool)) {
+          MarkObject(bytecode, constant_pool);
+        }
+      }
+    }
     local_weak_objects_->code_flushing_candidates_local.Push(shared_info);
   }
   return size;
@@ -4,11 +4,13 @@
 
 #include "src/heap/memory-reducer.h"
 
+#include "src/codegen/compilation-cache.h"
 #include "src/flags/flags.h"
 #include "src/heap/gc-tracer.h"
 #include "src/heap/heap-inl.h"
 #include "src/heap/incremental-marking.h"
 #include "src/init/v8.h"
+#include "src/strings/mapped-file-string-resource.h"
 #include "src/utils/utils.h"
 
 namespace v8 {
@@ -81,6 +83,14 @@ void MemoryReducer::NotifyTimer(const Event& event) {
     heap()->StartIncrementalMarking(GCFlag::kReduceMemoryFootprint,
                                     GarbageCollectionReason::kMemoryReducer,
                                     kGCCallbackFlagCollectAllExternalMemory);
+    // Scripts that were not compiled again since the last time are unlikely
+    // to be compiled soon.
+    if (v8_flags.process_wide_script_cache) {
+      ProcessWideScriptCache::Get()->Age();
+    }
+    // Script sources mapped from files are mostly needed again only for
+    // lazy compilation; the pages that are will be read back in.
+    MappedFileStringResource::DiscardAllResidentPages();
   } else if (state_.id() == kWait) {
     // Re-schedule the timer.
     ScheduleTimer(state_.next_gc_start_ms() - event.time_ms);
@@ -980,6 +980,12 @@ class V8_EXPORT_PRIVATE Bytecodes final : public AllStatic {
   // dispatch to a Star bytecode.
   static bool IsStarLookahead(Bytecode bytecode, OperandScale operand_scale);
 
+  // Returns true if the handler for |bytecode| should look ahead and inline a
+  // dispatch to a JumpIfTrue or JumpIfFalse bytecode. Such bytecodes always
+  // leave a boolean in the accumulator.
+  static bool IsJumpIfBooleanLookahead(Bytecode bytecode,
+                                       OperandScale operand_scale);
+
   // Returns the number of registers represented by a register operand. For
   // instance, a RegPair represents two registers. Should not be called for
   // kRegList which has a variable number of registers based on the following
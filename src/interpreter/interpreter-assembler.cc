@@ -44,7 +44,8 @@ InterpreterAssembler::InterpreterAssembler(CodeAssemblerState* state,
       implicit_register_use_(ImplicitRegisterUse::kNone),
       made_call_(false),
       reloaded_frame_ptr_(false),
-      bytecode_array_valid_(true) {
+      bytecode_array_valid_(true),
+      prefetched_next_handler_(false) {
 #ifdef V8_TRACE_UNOPTIMIZED
   TraceBytecode(Runtime::kTraceUnoptimizedBytecodeEntry);
 #endif
@@ -57,6 +58,11 @@ InterpreterAssembler::InterpreterAssembler(CodeAssemblerState* state,
       Bytecodes::Returns(bytecode)) {
     SaveBytecodeOffset();
   }
+
+  if (V8_IGNITION_DISPATCH_PREFETCH_BOOL && !made_call_ &&
+      PrefetchesNextHandler(bytecode, operand_scale)) {
+    PrefetchNextHandler();
+  }
 }
 
 InterpreterAssembler::~InterpreterAssembler() {
@@ -68,6 +74,48 @@ InterpreterAssembler::~InterpreterAssembler() {
   UnregisterCallGenerationCallbacks();
 }
 
+// static
+bool InterpreterAssembler::PrefetchesNextHandler(Bytecode bytecode,
+                                                 OperandScale operand_scale) {
+  if (operand_scale != OperandScale::kSingle) return false;
+  // Short handlers which make no calls and always fall through to the next
+  // bytecode.
+  switch (bytecode) {
+    case Bytecode::kLdar:
+    case Bytecode::kStar:
+    case Bytecode::kStar0:
+    case Bytecode::kMov:
+    case Bytecode::kLdaZero:
+    case Bytecode::kLdaSmi:
+    case Bytecode::kLdaUndefined:
+    case Bytecode::kLdaNull:
+    case Bytecode::kLdaTheHole:
+    case Bytecode::kLdaTrue:
+    case Bytecode::kLdaFalse:
+    case Bytecode::kLdaConstant:
+    case Bytecode::kTestReferenceEqual:
+    case Bytecode::kTestUndetectable:
+    case Bytecode::kTestNull:
+    case Bytecode::kTestUndefined:
+      return true;
+    default:
+      return false;
+  }
+}
+
+void InterpreterAssembler::PrefetchNextHandler() {
+  DCHECK(!made_call_);
+  // Without calls, neither the bytecode array nor the dispatch table can
+  // change before the handler dispatches, so the loads for the dispatch can
+  // be issued before the handler body and overlap with it.
+  TNode<IntPtrT> next_offset =
+      IntPtrAdd(BytecodeOffset(), IntPtrConstant(CurrentBytecodeSize()));
+  prefetched_bytecode_ = LoadBytecode(next_offset);
+  prefetched_handler_entry_ = Load<RawPtrT>(
+      DispatchTablePointer(), TimesSystemPointerSize(prefetched_bytecode_));
+  prefetched_next_handler_ = true;
+}
+
 TNode<RawPtrT> InterpreterAssembler::GetInterpretedFramePointer() {
   if (!interpreted_frame_pointer_.IsBound()) {
     interpreted_frame_pointer_ = LoadParentFramePointer();
@@ -1244,6 +1292,10 @@ void InterpreterAssembler::StarDispatchLookahead(TNode<WordT> target_bytecode) {
 void InterpreterAssembler::InlineShortStar(TNode<WordT> target_bytecode) {
   Bytecode previous_bytecode = bytecode_;
   ImplicitRegisterUse previous_acc_use = implicit_register_use_;
+  // The prefetched handler is the one for this Star, not for the bytecode
+  // after it.
+  bool previous_prefetched_next_handler = prefetched_next_handler_;
+  prefetched_next_handler_ = false;
 
   // At this point we don't know statically what bytecode we're executing, but
   // kStar0 has the right attributes (namely, no operands) for any of the short
@@ -1263,22 +1315,95 @@ void InterpreterAssembler::InlineShortStar(TNode<WordT> target_bytecode) {
   Advance();
   bytecode_ = previous_bytecode;
   implicit_register_use_ = previous_acc_use;
+  prefetched_next_handler_ = previous_prefetched_next_handler;
+}
+
+void InterpreterAssembler::JumpIfBooleanDispatchLookahead(
+    TNode<WordT> target_bytecode) {
+  Label do_inline_jump_if_true(this), do_inline_jump_if_false(this),
+      done(this);
+
+  // Comparisons are mostly followed by a conditional jump on their result.
+  // The accumulator is known to hold a boolean here, so the jump can be done
+  // without dispatching to its handler first.
+  GotoIf(WordEqual(target_bytecode,
+                   IntPtrConstant(static_cast<int>(Bytecode::kJumpIfTrue))),
+         &do_inline_jump_if_true);
+  Branch(WordEqual(target_bytecode,
+                   IntPtrConstant(static_cast<int>(Bytecode::kJumpIfFalse))),
+         &do_inline_jump_if_false, &done);
+
+  BIND(&do_inline_jump_if_true);
+  InlineJumpIfBoolean(Bytecode::kJumpIfTrue, TrueConstant());
+
+  BIND(&do_inline_jump_if_false);
+  InlineJumpIfBoolean(Bytecode::kJumpIfFalse, FalseConstant());
+
+  BIND(&done);
+}
+
+void InterpreterAssembler::InlineJumpIfBoolean(Bytecode jump_bytecode,
+                                               TNode<Boolean> value) {
+  DCHECK(jump_bytecode == Bytecode::kJumpIfTrue ||
+         jump_bytecode == Bytecode::kJumpIfFalse);
+  Bytecode previous_bytecode = bytecode_;
+  ImplicitRegisterUse previous_acc_use = implicit_register_use_;
+  // The prefetched handler is the one for this jump, so the dispatch when it
+  // is not taken has to load the handler of the bytecode after the jump.
+  bool previous_prefetched_next_handler = prefetched_next_handler_;
+  prefetched_next_handler_ = false;
+
+  // Operands are now read relative to the jump.
+  bytecode_ = jump_bytecode;
+  implicit_register_use_ = ImplicitRegisterUse::kNone;
+
+#ifdef V8_TRACE_UNOPTIMIZED
+  TraceBytecode(Runtime::kTraceUnoptimizedBytecodeEntry);
+#endif
+
+  TNode<Object> accumulator = GetAccumulator();
+  CSA_DCHECK(this, IsBoolean(CAST(accumulator)));
+
+  DCHECK_EQ(implicit_register_use_,
+            Bytecodes::GetImplicitRegisterUse(bytecode_));
+
+  // Both outcomes end in their own dispatch, see StarDispatchLookahead.
+  JumpIfTaggedEqual(accumulator, value, 0);
+
+  bytecode_ = previous_bytecode;
+  implicit_register_use_ = previous_acc_use;
+  prefetched_next_handler_ = previous_prefetched_next_handler;
 }
 
 void InterpreterAssembler::Dispatch() {
   Comment("========= Dispatch");
   DCHECK_IMPLIES(Bytecodes::MakesCallAlongCriticalPath(bytecode_), made_call_);
   TNode<IntPtrT> target_offset = Advance();
+  if (prefetched_next_handler_) {
+    DCHECK(!made_call_);
+    DispatchLookahead(prefetched_bytecode_);
+    if (V8_IGNITION_DISPATCH_COUNTING_BOOL) {
+      TraceBytecodeDispatch(prefetched_bytecode_);
+    }
+    DispatchToBytecodeHandlerEntry(prefetched_handler_entry_, target_offset);
+    return;
+  }
   TNode<WordT> target_bytecode = LoadBytecode(target_offset);
-  DispatchToBytecodeWithOptionalStarLookahead(target_bytecode);
+  DispatchToBytecodeWithOptionalLookahead(target_bytecode);
 }
 
-void InterpreterAssembler::DispatchToBytecodeWithOptionalStarLookahead(
+void InterpreterAssembler::DispatchToBytecodeWithOptionalLookahead(
     TNode<WordT> target_bytecode) {
+  DispatchLookahead(target_bytecode);
+  DispatchToBytecode(target_bytecode, BytecodeOffset());
+}
+
+void InterpreterAssembler::DispatchLookahead(TNode<WordT> target_bytecode) {
   if (Bytecodes::IsStarLookahead(bytecode_, operand_scale_)) {
     StarDispatchLookahead(target_bytecode);
+  } else if (Bytecodes::IsJumpIfBooleanLookahead(bytecode_, operand_scale_)) {
+    JumpIfBooleanDispatchLookahead(target_bytecode);
   }
-  DispatchToBytecode(target_bytecode, BytecodeOffset());
 }
 
 void InterpreterAssembler::DispatchToBytecode(
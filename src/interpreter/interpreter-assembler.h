@@ -288,9 +288,9 @@ class V8_EXPORT_PRIVATE InterpreterAssembler : public CodeStubAssembler {
 
   // Dispatches to |target_bytecode| at BytecodeOffset(). Includes short-star
   // lookahead if the current bytecode_ is likely followed by a short-star
-  // instruction.
-  void DispatchToBytecodeWithOptionalStarLookahead(
-      TNode<WordT> target_bytecode);
+  // instruction, and JumpIfTrue/JumpIfFalse lookahead if it is likely
+  // followed by a conditional jump on its result.
+  void DispatchToBytecodeWithOptionalLookahead(TNode<WordT> target_bytecode);
 
   // Abort with the given abort reason.
   void Abort(AbortReason abort_reason);
@@ -440,6 +440,10 @@ class V8_EXPORT_PRIVATE InterpreterAssembler : public CodeStubAssembler {
   TNode<IntPtrT> Advance(int delta);
   TNode<IntPtrT> Advance(TNode<IntPtrT> delta);
 
+  // Does the short-star or JumpIfTrue/JumpIfFalse lookahead for the current
+  // bytecode_, if any.
+  void DispatchLookahead(TNode<WordT> target_bytecode);
+
   // Look ahead for short Star and inline it in a branch, including subsequent
   // dispatch. Anything after this point can assume that the following
   // instruction was not a short Star.
@@ -449,12 +453,30 @@ class V8_EXPORT_PRIVATE InterpreterAssembler : public CodeStubAssembler {
   // the next dispatch offset.
   void InlineShortStar(TNode<WordT> target_bytecode);
 
+  // Look ahead for JumpIfTrue or JumpIfFalse and inline it in a branch,
+  // including the subsequent jump or dispatch. Anything after this point can
+  // assume that the following instruction was neither of them.
+  void JumpIfBooleanDispatchLookahead(TNode<WordT> target_bytecode);
+
+  // Build code for |jump_bytecode| (JumpIfTrue or JumpIfFalse) at the current
+  // BytecodeOffset(), which jumps if the accumulator is |value| and
+  // dispatches to the next bytecode otherwise.
+  void InlineJumpIfBoolean(Bytecode jump_bytecode, TNode<Boolean> value);
+
   // Dispatch to the bytecode handler with code entry point |handler_entry|.
   void DispatchToBytecodeHandlerEntry(TNode<RawPtrT> handler_entry,
                                       TNode<IntPtrT> bytecode_offset);
 
   int CurrentBytecodeSize() const;
 
+  // Returns true if the handler for |bytecode| loads the next bytecode and
+  // its handler on entry, in builds with v8_enable_ignition_dispatch_prefetch.
+  static bool PrefetchesNextHandler(Bytecode bytecode,
+                                    OperandScale operand_scale);
+
+  // Loads the next bytecode and its handler entry for Dispatch().
+  void PrefetchNextHandler();
+
   OperandScale operand_scale() const { return operand_scale_; }
 
   Bytecode bytecode_;
@@ -468,6 +490,9 @@ class V8_EXPORT_PRIVATE InterpreterAssembler : public CodeStubAssembler {
   bool made_call_;
   bool reloaded_frame_ptr_;
   bool bytecode_array_valid_;
+  bool prefetched_next_handler_;
+  TNode<WordT> prefetched_bytecode_;
+  TNode<RawPtrT> prefetched_handler_entry_;
 };
 
 }  // namespace interpreter
@@ -2904,7 +2904,7 @@ IGNITION_HANDLER(Debugger, InterpreterAssembler) {
     TNode<Object> return_value = Projection<0>(result_pair);                 \
     TNode<IntPtrT> original_bytecode = SmiUntag(Projection<1>(result_pair)); \
     SetAccumulator(return_value);                                            \
-    DispatchToBytecodeWithOptionalStarLookahead(original_bytecode);          \
+    DispatchToBytecodeWithOptionalLookahead(original_bytecode);              \
   }
 DEBUG_BREAK_BYTECODE_LIST(DEBUG_BREAK)
 #undef DEBUG_BREAK
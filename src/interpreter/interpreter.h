@@ -119,6 +119,12 @@ class Interpreter {
 #define V8_IGNITION_DISPATCH_COUNTING_BOOL false
 #endif
 
+#ifdef V8_IGNITION_DISPATCH_PREFETCH
+#define V8_IGNITION_DISPATCH_PREFETCH_BOOL true
+#else
+#define V8_IGNITION_DISPATCH_PREFETCH_BOOL false
+#endif
+
 }  // namespace interpreter
 }  // namespace internal
 }  // namespace v8
@@ -0,0 +1,67 @@
+// Copyright 2024 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#ifndef V8_JSON_JSON_SIMD_H_
+#define V8_JSON_JSON_SIMD_H_
+
+#include <cstdint>
+
+#include "src/strings/string-simd.h"
+
+namespace v8 {
+namespace internal {
+
+// Returns true for the one-byte characters that are special inside a JSON
+// string: '"', '\\' and control characters. These terminate a string while
+// parsing, and have to be escaped while stringifying.
+constexpr bool IsJsonSpecialCharacter(uint8_t c) {
+  return c < 0x20 || c == '"' || c == '\\';
+}
+
+struct JsonSpecialCharacterMatcher {
+  bool operator()(uint8_t c) const { return IsJsonSpecialCharacter(c); }
+#ifdef __SSE3__
+  __m128i operator()(__m128i chars) const {
+    // There is no unsigned byte comparison in SSE, so {c <= 0x1F} is computed
+    // as {min(c, 0x1F) == c}.
+    __m128i control = _mm_cmpeq_epi8(_mm_min_epu8(chars, _mm_set1_epi8(0x1F)),
+                                     chars);
+    return _mm_or_si128(
+        _mm_or_si128(_mm_cmpeq_epi8(chars, _mm_set1_epi8('"')),
+                     _mm_cmpeq_epi8(chars, _mm_set1_epi8('\\'))),
+        control);
+  }
+#endif
+#ifdef V8_STRING_SIMD_AVX2
+  V8_TARGET_AVX2 __m256i operator()(__m256i chars) const {
+    __m256i control = _mm256_cmpeq_epi8(
+        _mm256_min_epu8(chars, _mm256_set1_epi8(0x1F)), chars);
+    return _mm256_or_si256(
+        _mm256_or_si256(_mm256_cmpeq_epi8(chars, _mm256_set1_epi8('"')),
+                        _mm256_cmpeq_epi8(chars, _mm256_set1_epi8('\\'))),
+        control);
+  }
+#endif
+#ifdef NEON64
+  uint8x16_t operator()(uint8x16_t chars) const {
+    return vorrq_u8(vorrq_u8(vceqq_u8(chars, vdupq_n_u8('"')),
+                             vceqq_u8(chars, vdupq_n_u8('\\'))),
+                    vcltq_u8(chars, vdupq_n_u8(0x20)));
+  }
+#endif
+};
+
+// Returns the first special character (see above) in [start, end), or {end}
+// if there is none. This looks at 16 or 32 characters at a time where SIMD is
+// available, which pays off for the long strings that dominate large JSON
+// payloads.
+inline const uint8_t* FindJsonSpecialCharacter(const uint8_t* start,
+                                               const uint8_t* end) {
+  return FindFirstMatchingCharacter(start, end, JsonSpecialCharacterMatcher());
+}
+
+}  // namespace internal
+}  // namespace v8
+
+#endif  // V8_JSON_JSON_SIMD_H_
@@ -8,6 +8,7 @@
 #include "src/common/assert-scope.h"
 #include "src/common/message-template.h"
 #include "src/execution/protectors-inl.h"
+#include "src/json/json-simd.h"
 #include "src/numbers/conversions.h"
 #include "src/objects/elements-kind.h"
 #include "src/objects/heap-number-inl.h"
@@ -20,6 +21,8 @@
 #include "src/objects/smi.h"
 #include "src/objects/tagged.h"
 #include "src/strings/string-builder-inl.h"
+#include "src/strings/unicode-decoder.h"
+#include "src/strings/unicode-inl.h"
 
 namespace v8 {
 namespace internal {
@@ -38,9 +41,20 @@ class JsonStringifier {
                                                       Handle<Object> replacer,
                                                       Handle<Object> gap);
 
+  // Like Stringify, but writes the result to {sink} as UTF-8 directly from
+  // the serialization buffer instead of creating a String.
+  V8_WARN_UNUSED_RESULT Maybe<bool> StringifyToUtf8(Handle<Object> object,
+                                                   Handle<Object> replacer,
+                                                   Handle<Object> gap,
+                                                   v8::JSON::Utf8Sink* sink);
+
  private:
   enum Result { UNCHANGED, SUCCESS, EXCEPTION, NEED_STACK };
 
+  // Serializes {object} into the buffer. Never returns NEED_STACK.
+  Result SerializeTopLevel(Handle<Object> object, Handle<Object> replacer,
+                           Handle<Object> gap);
+
   bool InitializeReplacer(Handle<Object> replacer);
   bool InitializeGap(Handle<Object> gap);
 
@@ -398,12 +412,87 @@ class JsonStringifier {
   static const bool JsonDoNotEscapeFlagTable[];
 };
 
+namespace {
+
+// Batches the output of StringifyToUtf8, so that the sink is called for large
+// chunks only.
+class Utf8SinkBuffer {
+ public:
+  explicit Utf8SinkBuffer(v8::JSON::Utf8Sink* sink) : sink_(sink) {}
+  ~Utf8SinkBuffer() { Flush(); }
+
+  void AppendAscii(const uint8_t* chars, size_t length) {
+    if (length >= kBufferSize) {
+      Flush();
+      sink_->Append(reinterpret_cast<const char*>(chars), length);
+      return;
+    }
+    if (length > kBufferSize - used_) Flush();
+    MemCopy(buffer_ + used_, chars, length);
+    used_ += length;
+  }
+
+  void AppendCodePoint(unibrow::uchar c) {
+    if (kBufferSize - used_ < unibrow::Utf8::kMaxEncodedSize) Flush();
+    used_ += unibrow::Utf8::Encode(buffer_ + used_, c,
+                                   unibrow::Utf16::kNoPreviousCharacter, true);
+  }
+
+ private:
+  void Flush() {
+    if (used_ == 0) return;
+    sink_->Append(buffer_, used_);
+    used_ = 0;
+  }
+
+  static constexpr size_t kBufferSize = 4 * KB;
+  v8::JSON::Utf8Sink* sink_;
+  size_t used_ = 0;
+  char buffer_[kBufferSize];
+};
+
+// Runs of ASCII characters are copied in bulk.
+void WriteUtf8(base::Vector<const uint8_t> chars, v8::JSON::Utf8Sink* sink) {
+  Utf8SinkBuffer buffer(sink);
+  int i = 0;
+  while (i < chars.length()) {
+    int ascii_length = NonAsciiStart(chars.begin() + i, chars.length() - i);
+    buffer.AppendAscii(chars.begin() + i, ascii_length);
+    i += ascii_length;
+    if (i < chars.length()) buffer.AppendCodePoint(chars[i++]);
+  }
+}
+
+// The stringifier escapes lone surrogates, but they are written as U+FFFD
+// should one ever show up.
+void WriteUtf8(base::Vector<const base::uc16> chars,
+               v8::JSON::Utf8Sink* sink) {
+  Utf8SinkBuffer buffer(sink);
+  for (int i = 0; i < chars.length(); i++) {
+    unibrow::uchar c = chars[i];
+    if (unibrow::Utf16::IsLeadSurrogate(c) && i + 1 < chars.length() &&
+        unibrow::Utf16::IsTrailSurrogate(chars[i + 1])) {
+      c = unibrow::Utf16::CombineSurrogatePair(c, chars[++i]);
+    }
+    buffer.AppendCodePoint(c);
+  }
+}
+
+}  // namespace
+
 MaybeHandle<Object> JsonStringify(Isolate* isolate, Handle<Object> object,
                                   Handle<Object> replacer, Handle<Object> gap) {
   JsonStringifier stringifier(isolate);
   return stringifier.Stringify(object, replacer, gap);
 }
 
+Maybe<bool> JsonStringifyToUtf8(Isolate* isolate, Handle<Object> object,
+                                Handle<Object> replacer, Handle<Object> gap,
+                                v8::JSON::Utf8Sink* sink) {
+  JsonStringifier stringifier(isolate);
+  return stringifier.StringifyToUtf8(object, replacer, gap, sink);
+}
+
 // Translation table to escape Latin1 characters.
 // Table entries start at a multiple of 8 and are null-terminated.
 const char* const JsonStringifier::JsonEscapeTable =
@@ -463,16 +552,15 @@ JsonStringifier::JsonStringifier(Isolate* isolate)
   part_ptr_ = one_byte_ptr_;
 }
 
-MaybeHandle<Object> JsonStringifier::Stringify(Handle<Object> object,
-                                               Handle<Object> replacer,
-                                               Handle<Object> gap) {
+JsonStringifier::Result JsonStringifier::SerializeTopLevel(
+    Handle<Object> object, Handle<Object> replacer, Handle<Object> gap) {
   if (!InitializeReplacer(replacer)) {
     CHECK(isolate_->has_exception());
-    return MaybeHandle<Object>();
+    return EXCEPTION;
   }
   if (!IsUndefined(*gap, isolate_) && !InitializeGap(gap)) {
     CHECK(isolate_->has_exception());
-    return MaybeHandle<Object>();
+    return EXCEPTION;
   }
   Result result = SerializeObject(object);
   if (result == NEED_STACK) {
@@ -480,11 +568,21 @@ MaybeHandle<Object> JsonStringifier::Stringify(Handle<Object> object,
     current_index_ = 0;
     result = SerializeObject(object);
   }
+  if (result == SUCCESS &&
+      (overflowed_ || current_index_ > String::kMaxLength)) {
+    isolate_->Throw(*factory()->NewInvalidStringLengthError());
+    return EXCEPTION;
+  }
+  DCHECK_NE(result, NEED_STACK);
+  return result;
+}
+
+MaybeHandle<Object> JsonStringifier::Stringify(Handle<Object> object,
+                                               Handle<Object> replacer,
+                                               Handle<Object> gap) {
+  Result result = SerializeTopLevel(object, replacer, gap);
   if (result == UNCHANGED) return factory()->undefined_value();
   if (result == SUCCESS) {
-    if (overflowed_ || current_index_ > String::kMaxLength) {
-      THROW_NEW_ERROR(isolate_, NewInvalidStringLengthError(), String);
-    }
     if (encoding_ == String::ONE_BYTE_ENCODING) {
       return isolate_->factory()
           ->NewStringFromOneByte(base::OneByteVector(
@@ -500,6 +598,33 @@ MaybeHandle<Object> JsonStringifier::Stringify(Handle<Object> object,
   return MaybeHandle<Object>();
 }
 
+Maybe<bool> JsonStringifier::StringifyToUtf8(Handle<Object> object,
+                                             Handle<Object> replacer,
+                                             Handle<Object> gap,
+                                             v8::JSON::Utf8Sink* sink) {
+  Result result = SerializeTopLevel(object, replacer, gap);
+  if (result == EXCEPTION) {
+    CHECK(isolate_->has_exception());
+    return Nothing<bool>();
+  }
+  DisallowGarbageCollection no_gc;
+  if (result == UNCHANGED) {
+    // Stringify returns undefined here, which converts to "undefined".
+    static constexpr char kUndefined[] = "undefined";
+    sink->Append(kUndefined, arraysize(kUndefined) - 1);
+    return Just(true);
+  }
+  DCHECK_EQ(result, SUCCESS);
+  if (encoding_ == String::ONE_BYTE_ENCODING) {
+    WriteUtf8(base::Vector<const uint8_t>(one_byte_ptr_, current_index_),
+              sink);
+  } else {
+    WriteUtf8(base::Vector<const base::uc16>(two_byte_ptr_, current_index_),
+              sink);
+  }
+  return Just(true);
+}
+
 bool JsonStringifier::InitializeReplacer(Handle<Object> replacer) {
   DCHECK(property_list_.is_null());
   DCHECK(replacer_function_.is_null());
@@ -1374,6 +1499,24 @@ bool JsonStringifier::SerializeStringUnchecked_(
   // The <base::uc16, char> version of this method must not be called.
   DCHECK(sizeof(DestChar) >= sizeof(SrcChar));
   bool required_escaping = false;
+  if constexpr (sizeof(SrcChar) == 1 && !raw_json) {
+    // Find the characters that need escaping with SIMD and copy the runs in
+    // between in bulk.
+    const uint8_t* cursor = src.begin();
+    const uint8_t* end = src.end();
+    while (true) {
+      const uint8_t* special = FindJsonSpecialCharacter(cursor, end);
+      size_t run_length = special - cursor;
+      dest->AppendChars(base::VectorOf(cursor, run_length), run_length);
+      if (special == end) break;
+      DCHECK(!DoNotEscape(*special));
+      required_escaping = true;
+      dest->AppendCString(
+          &JsonEscapeTable[*special * kJsonEscapeTableEntrySize]);
+      cursor = special + 1;
+    }
+    return required_escaping;
+  }
   for (int i = 0; i < src.length(); i++) {
     SrcChar c = src[i];
     if (raw_json || DoNotEscape(c)) {
@@ -1445,6 +1588,28 @@ bool JsonStringifier::SerializeString_(Tagged<String> string,
         &current_index_);
     required_escaping = SerializeStringUnchecked_<SrcChar, DestChar, raw_json>(
         vector, &no_extend);
+  } else if (sizeof(SrcChar) == 1 && !raw_json) {
+    // Long one-byte strings are serialized in slices that fit the current
+    // part even if every character needs escaping, so that the bulk copying
+    // above applies to them as well. Surrogates cannot occur in one-byte
+    // strings, so any position is a valid slice boundary.
+    static constexpr int kMinSliceLength = 256;
+    base::Vector<const SrcChar> rest = vector;
+    while (!rest.empty()) {
+      int slice_length =
+          std::min(rest.length(), (part_length_ - current_index_ - 1) >> 3);
+      if (slice_length < std::min(rest.length(), kMinSliceLength)) {
+        Extend();
+        continue;
+      }
+      NoExtendBuilder<DestChar> no_extend(
+          reinterpret_cast<DestChar*>(part_ptr_) + current_index_,
+          &current_index_);
+      required_escaping |=
+          SerializeStringUnchecked_<SrcChar, DestChar, raw_json>(
+              rest.SubVector(0, slice_length), &no_extend);
+      rest += slice_length;
+    }
   } else {
     for (int i = 0; i < vector.length(); i++) {
       SrcChar c = vector.at(i);
@@ -5,6 +5,7 @@
 #ifndef V8_JSON_JSON_STRINGIFIER_H_
 #define V8_JSON_JSON_STRINGIFIER_H_
 
+#include "include/v8-json.h"
 #include "src/objects/objects.h"
 
 namespace v8 {
@@ -14,6 +15,15 @@ V8_WARN_UNUSED_RESULT MaybeHandle<Object> JsonStringify(Isolate* isolate,
                                                         Handle<Object> object,
                                                         Handle<Object> replacer,
                                                         Handle<Object> gap);
+
+// Like JsonStringify, but writes the result to {sink} as UTF-8, in chunks and
+// without creating a String.
+V8_WARN_UNUSED_RESULT Maybe<bool> JsonStringifyToUtf8(Isolate* isolate,
+                                                      Handle<Object> object,
+                                                      Handle<Object> replacer,
+                                                      Handle<Object> gap,
+                                                      v8::JSON::Utf8Sink* sink);
+
 }  // namespace internal
 }  // namespace v8
 
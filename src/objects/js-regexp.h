@@ -213,7 +213,11 @@ class JSRegExp : public TorqueGeneratedJSRegExp<JSRegExp, JSObject> {
   // above to save space.
   static constexpr int kIrregexpBacktrackLimit =
       kIrregexpTicksUntilTierUpIndex + 1;
-  static constexpr int kIrregexpDataSize = kIrregexpBacktrackLimit + 1;
+  // A sequential one-byte string that occurs in every match, or a Smi marker
+  // value equal to kUninitializedValue. See RegExpRequiredLiteral.
+  static constexpr int kIrregexpRequiredLiteralIndex =
+      kIrregexpBacktrackLimit + 1;
+  static constexpr int kIrregexpDataSize = kIrregexpRequiredLiteralIndex + 1;
 
   // TODO(mbid,v8:10765): At the moment the EXPERIMENTAL data array conforms
   // to the format of an IRREGEXP data array, with most fields set to some
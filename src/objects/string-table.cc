@@ -492,6 +492,68 @@ template Handle<String> StringTable::LookupKey(Isolate* isolate,
 template Handle<String> StringTable::LookupKey(LocalIsolate* isolate,
                                                StringTableInsertionKey* key);
 
+template <typename StringTableKey, typename IsolateT>
+void StringTable::LookupKeys(IsolateT* isolate,
+                             base::Vector<StringTableKey> keys,
+                             Handle<String>* results) {
+  // See LookupKey for why lock-free reads are safe. The data is reloaded for
+  // every key, since preparing a key for insertion allocates and may trigger a
+  // GC that drops old data.
+  int missing = 0;
+  for (size_t i = 0; i < keys.size(); ++i) {
+    StringTableKey* key = &keys[i];
+    OffHeapStringHashSet& current_table =
+        data_.load(std::memory_order_acquire)->table();
+    InternalIndex entry = current_table.FindEntry(isolate, key, key->hash());
+    if (entry.is_found()) {
+      results[i] = handle(String::cast(current_table.GetKey(isolate, entry)),
+                          isolate);
+      DCHECK_IMPLIES(v8_flags.shared_string_table,
+                     InAnySharedSpace(*results[i]));
+      continue;
+    }
+    results[i] = Handle<String>();
+    key->PrepareForInsertion(isolate);
+    ++missing;
+  }
+  if (missing == 0) return;
+
+  base::MutexGuard table_write_guard(&write_mutex_);
+
+  Data* data = EnsureCapacity(isolate, missing);
+  OffHeapStringHashSet& table = data->table();
+
+  for (size_t i = 0; i < keys.size(); ++i) {
+    if (!results[i].is_null()) continue;
+    StringTableKey* key = &keys[i];
+    // Check again whether the key has been added since the lock-free lookup,
+    // by another thread or by an earlier key of this batch.
+    InternalIndex entry =
+        table.FindEntryOrInsertionEntry(isolate, key, key->hash());
+    Tagged<Object> element = table.GetKey(isolate, entry);
+    if (element == OffHeapStringHashSet::empty_element()) {
+      Handle<String> new_string = key->GetHandleForInsertion();
+      DCHECK_IMPLIES(v8_flags.shared_string_table, new_string->IsShared());
+      table.AddAt(isolate, entry, *new_string);
+      results[i] = new_string;
+    } else if (element == OffHeapStringHashSet::deleted_element()) {
+      Handle<String> new_string = key->GetHandleForInsertion();
+      DCHECK_IMPLIES(v8_flags.shared_string_table, new_string->IsShared());
+      table.OverwriteDeletedAt(isolate, entry, *new_string);
+      results[i] = new_string;
+    } else {
+      results[i] = handle(String::cast(element), isolate);
+    }
+  }
+}
+
+template void StringTable::LookupKeys(Isolate* isolate,
+                                      base::Vector<OneByteStringKey> keys,
+                                      Handle<String>* results);
+template void StringTable::LookupKeys(LocalIsolate* isolate,
+                                      base::Vector<OneByteStringKey> keys,
+                                      Handle<String>* results);
+
 StringTable::Data* StringTable::EnsureCapacity(PtrComprCageBase cage_base,
                                                int additional_elements) {
   // This call is only allowed while the write mutex is held.
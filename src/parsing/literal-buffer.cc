@@ -65,6 +65,21 @@ void LiteralBuffer::ConvertToTwoByte() {
   is_one_byte_ = false;
 }
 
+void LiteralBuffer::AddAsciiChars(base::Vector<const uint16_t> code_units) {
+  if (code_units.empty()) return;
+  int size = code_units.length() * (is_one_byte() ? kOneByteSize
+                                                  : base::kUC16Size);
+  while (position_ + size > backing_store_.length()) ExpandBuffer();
+  if (is_one_byte()) {
+    CopyChars(&backing_store_[position_], code_units.begin(),
+              code_units.length());
+  } else {
+    CopyChars(reinterpret_cast<uint16_t*>(&backing_store_[position_]),
+              code_units.begin(), code_units.length());
+  }
+  position_ += size;
+}
+
 void LiteralBuffer::AddTwoByteChar(base::uc32 code_unit) {
   DCHECK(!is_one_byte());
   if (position_ >= backing_store_.length()) ExpandBuffer();
@@ -0,0 +1,608 @@
+// Copyright 2024 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#include "src/parsing/parallel-preparser.h"
+
+#include <algorithm>
+#include <string_view>
+
+#include "src/ast/ast-value-factory.h"
+#include "src/ast/scopes.h"
+#include "src/flags/flags.h"
+#include "src/init/v8.h"
+#include "src/objects/string-inl.h"
+#include "src/parsing/pending-compilation-error-handler.h"
+#include "src/parsing/preparser.h"
+#include "src/parsing/scanner-character-streams.h"
+#include "src/parsing/scanner.h"
+#include "src/strings/char-predicates-inl.h"
+#include "src/utils/utils.h"
+#include "src/zone/zone.h"
+
+namespace v8 {
+namespace internal {
+
+namespace {
+
+constexpr base::uc32 kEndOfInput = Utf16CharacterStream::kEndOfInput;
+
+bool IsLineTerminator(base::uc32 c) {
+  return c == '\n' || c == '\r' || c == 0x2028 || c == 0x2029;
+}
+
+// Non-ASCII characters are rare outside of strings and comments, and counting
+// them as identifier characters keeps the scan simple.
+bool IsIdentifierChar(base::uc32 c) {
+  return IsAsciiIdentifier(c) || c == '\\' || (c >= 0x80 && c != kEndOfInput);
+}
+
+// Finds the functions at brace depth zero of a script, for
+// ParallelPreparser. This is a scan over the characters that only tracks
+// what can hide a brace: strings, comments, template and regexp literals. It
+// gives up on sources it cannot follow, and on a '/' after a '}', which could
+// start a regexp or a division.
+class TopLevelFunctionScanner {
+ public:
+  struct Function {
+    int start_position;
+    FunctionKind kind;
+  };
+
+  TopLevelFunctionScanner(Utf16CharacterStream* stream,
+                          const std::atomic<bool>* cancelled)
+      : stream_(stream), cancelled_(cancelled) {}
+
+  bool Scan(std::vector<Function>* functions, LanguageMode* language_mode);
+
+ private:
+  // What the previous token tells about a following '/'.
+  enum class Previous {
+    kOperator,    // A regexp.
+    kOperand,     // A division.
+    kCloseBrace,  // Either.
+    kOpenParen,   // A regexp; also marks likely-called functions.
+    kDot,         // Neither; only a property name can follow.
+  };
+
+  enum class FunctionState { kNone, kAfterKeyword, kAfterStar, kAfterName };
+
+  bool SkipString(base::uc32 quote, bool* is_use_strict);
+  bool SkipTemplate();
+  bool SkipRegExp();
+  bool SkipBlockComment();
+  void SkipLineComment();
+  void ScanIdentifier(base::uc32 first);
+  bool Check(base::uc32 c) {
+    if (stream_->Peek() != c) return false;
+    stream_->Advance();
+    return true;
+  }
+
+  Utf16CharacterStream* const stream_;
+  const std::atomic<bool>* const cancelled_;
+  std::vector<Function>* functions_ = nullptr;
+  // One entry per open '{' or '${'; true for template substitutions.
+  std::vector<bool> braces_;
+  Previous previous_ = Previous::kOperator;
+  bool newline_before_ = true;
+  bool is_first_token_ = true;
+  bool first_token_is_use_strict_ = false;
+
+  // State of a function literal being recognized.
+  FunctionState function_state_ = FunctionState::kNone;
+  bool previous_is_async_ = false;
+  Previous previous_before_async_ = Previous::kOperator;
+  bool function_is_async_ = false;
+  bool function_is_generator_ = false;
+  bool function_is_candidate_ = false;
+};
+
+bool TopLevelFunctionScanner::Scan(std::vector<Function>* functions,
+                                   LanguageMode* language_mode) {
+  functions_ = functions;
+  for (int steps = 1;; steps++) {
+    if ((steps & 0xFFFF) == 0 && cancelled_->load(std::memory_order_relaxed)) {
+      return false;
+    }
+    const int position = static_cast<int>(stream_->pos());
+    const base::uc32 c = stream_->Advance();
+    if (c == kEndOfInput) break;
+    if (c == ' ' || c == '\t' || c == '\v' || c == '\f') continue;
+    if (IsLineTerminator(c)) {
+      newline_before_ = true;
+      continue;
+    }
+    // Comments are not tokens.
+    if (c == '/' && Check('/')) {
+      SkipLineComment();
+      continue;
+    }
+    if (c == '/' && Check('*')) {
+      if (!SkipBlockComment()) return false;
+      continue;
+    }
+    if (c == '<' && Check('!')) {
+      if (Check('-') && Check('-')) {
+        SkipLineComment();
+        continue;
+      }
+      // Not an HTML comment; the characters read are operators anyway.
+    } else if (c == '-' && newline_before_ && Check('-')) {
+      if (Check('>')) {
+        SkipLineComment();
+        continue;
+      }
+    }
+
+    const bool is_first_token = is_first_token_;
+    is_first_token_ = false;
+    const bool previous_is_async = previous_is_async_;
+    previous_is_async_ = false;
+    const bool newline_before = newline_before_;
+    newline_before_ = false;
+    FunctionState function_state = function_state_;
+    function_state_ = FunctionState::kNone;
+
+    if (IsIdentifierChar(c) && !IsDecimalDigit(c)) {
+      const Previous previous = previous_;
+      ScanIdentifier(c);
+      if (function_state == FunctionState::kAfterKeyword ||
+          function_state == FunctionState::kAfterStar) {
+        // The function name.
+        function_state_ = FunctionState::kAfterName;
+        previous_is_async_ = false;
+        previous_ = Previous::kOperand;
+      } else if (previous == Previous::kDot) {
+        // A property name, even if it looks like a keyword.
+        function_state_ = FunctionState::kNone;
+        previous_is_async_ = false;
+        previous_ = Previous::kOperand;
+      } else if (function_state_ == FunctionState::kAfterKeyword) {
+        // "async function", unless a line break separates the two.
+        function_is_async_ = previous_is_async && !newline_before;
+        // Functions right after a '(' are likely called immediately, and
+        // the parser compiles those eagerly.
+        Previous before =
+            function_is_async_ ? previous_before_async_ : previous;
+        function_is_candidate_ =
+            braces_.empty() && before != Previous::kOpenParen;
+      } else if (previous_is_async_) {
+        previous_before_async_ = previous;
+      }
+      continue;
+    }
+    if (IsDecimalDigit(c) || (c == '.' && IsDecimalDigit(stream_->Peek()))) {
+      // Numbers, including exponents, separators and BigInt suffixes.
+      while (IsAsciiIdentifier(stream_->Peek()) || stream_->Peek() == '.') {
+        stream_->Advance();
+      }
+      previous_ = Previous::kOperand;
+      continue;
+    }
+
+    switch (c) {
+      case '\'':
+      case '"': {
+        bool is_use_strict;
+        if (!SkipString(c, &is_use_strict)) return false;
+        if (is_first_token) first_token_is_use_strict_ = is_use_strict;
+        previous_ = Previous::kOperand;
+        break;
+      }
+      case '`':
+        if (!SkipTemplate()) return false;
+        break;
+      case '/':
+        if (previous_ == Previous::kCloseBrace) return false;
+        if (previous_ == Previous::kOperand) {
+          previous_ = Previous::kOperator;
+        } else {
+          if (!SkipRegExp()) return false;
+          previous_ = Previous::kOperand;
+        }
+        break;
+      case '{':
+        braces_.push_back(false);
+        previous_ = Previous::kOperator;
+        break;
+      case '}': {
+        if (braces_.empty()) return false;
+        const bool is_substitution = braces_.back();
+        braces_.pop_back();
+        if (is_substitution) {
+          if (!SkipTemplate()) return false;
+        } else {
+          previous_ = Previous::kCloseBrace;
+        }
+        break;
+      }
+      case '(':
+        if (function_state != FunctionState::kNone && function_is_candidate_) {
+          FunctionKind kind =
+              function_is_async_
+                  ? (function_is_generator_
+                         ? FunctionKind::kAsyncGeneratorFunction
+                         : FunctionKind::kAsyncFunction)
+                  : (function_is_generator_ ? FunctionKind::kGeneratorFunction
+                                            : FunctionKind::kNormalFunction);
+          functions_->push_back({position, kind});
+        }
+        previous_ = Previous::kOpenParen;
+        break;
+      case ')':
+      case ']':
+        previous_ = Previous::kOperand;
+        break;
+      case '.':
+        previous_ = Previous::kDot;
+        break;
+      case '*':
+        if (function_state == FunctionState::kAfterKeyword) {
+          function_is_generator_ = true;
+          function_state_ = FunctionState::kAfterStar;
+        }
+        previous_ = Previous::kOperator;
+        break;
+      default:
+        previous_ = Previous::kOperator;
+        break;
+    }
+  }
+  if (!braces_.empty()) return false;
+  *language_mode = first_token_is_use_strict_ ? LanguageMode::kStrict
+                                              : LanguageMode::kSloppy;
+  return true;
+}
+
+void TopLevelFunctionScanner::ScanIdentifier(base::uc32 first) {
+  // Long enough for every keyword that matters here.
+  static constexpr int kMaxLength = 10;
+  char name[kMaxLength + 1];
+  int length = 0;
+  base::uc32 c = first;
+  while (true) {
+    if (length <= kMaxLength) {
+      name[length++] = c < 0x80 ? static_cast<char>(c) : '\0';
+    }
+    if (!IsIdentifierChar(stream_->Peek())) break;
+    c = stream_->Advance();
+  }
+  previous_ = Previous::kOperand;
+  if (length > kMaxLength) return;
+  name[length] = '\0';
+  std::string_view word(name, length);
+  if (word == "function") {
+    function_state_ = FunctionState::kAfterKeyword;
+    function_is_async_ = false;
+    function_is_generator_ = false;
+    previous_ = Previous::kOperator;
+  } else if (word == "async") {
+    previous_is_async_ = true;
+  } else if (word == "return" || word == "typeof" || word == "instanceof" ||
+             word == "in" || word == "of" || word == "new" ||
+             word == "delete" || word == "void" || word == "throw" ||
+             word == "case" || word == "do" || word == "else" ||
+             word == "yield" || word == "await" || word == "extends") {
+    previous_ = Previous::kOperator;
+  }
+}
+
+bool TopLevelFunctionScanner::SkipString(base::uc32 quote,
+                                         bool* is_use_strict) {
+  static constexpr char kUseStrict[] = "use strict";
+  static constexpr size_t kUseStrictLength = sizeof(kUseStrict) - 1;
+  bool matches = true;
+  size_t length = 0;
+  while (true) {
+    base::uc32 c = stream_->Advance();
+    if (c == quote) break;
+    if (c == kEndOfInput || c == '\n' || c == '\r') return false;
+    if (c == '\\') {
+      // An escape sequence makes the directive not count.
+      matches = false;
+      c = stream_->Advance();
+      if (c == kEndOfInput) return false;
+      if (c == '\r') Check('\n');
+      continue;
+    }
+    if (length >= kUseStrictLength ||
+        c != static_cast<base::uc32>(kUseStrict[length])) {
+      matches = false;
+    }
+    length++;
+  }
+  *is_use_strict = matches && length == kUseStrictLength;
+  return true;
+}
+
+bool TopLevelFunctionScanner::SkipTemplate() {
+  while (true) {
+    base::uc32 c = stream_->Advance();
+    if (c == kEndOfInput) return false;
+    if (c == '`') {
+      previous_ = Previous::kOperand;
+      return true;
+    }
+    if (c == '\\') {
+      if (stream_->Advance() == kEndOfInput) return false;
+    } else if (c == '$' && Check('{')) {
+      braces_.push_back(true);
+      previous_ = Previous::kOperator;
+      return true;
+    }
+  }
+}
+
+bool TopLevelFunctionScanner::SkipRegExp() {
+  bool in_class = false;
+  while (true) {
+    base::uc32 c = stream_->Advance();
+    if (c == kEndOfInput || IsLineTerminator(c)) return false;
+    if (c == '\\') {
+      c = stream_->Advance();
+      if (c == kEndOfInput || IsLineTerminator(c)) return false;
+    } else if (c == '[') {
+      in_class = true;
+    } else if (c == ']') {
+      in_class = false;
+    } else if (c == '/' && !in_class) {
+      // The flags are scanned as an identifier.
+      return true;
+    }
+  }
+}
+
+bool TopLevelFunctionScanner::SkipBlockComment() {
+  while (true) {
+    base::uc32 c = stream_->Advance();
+    if (c == kEndOfInput) return false;
+    if (IsLineTerminator(c)) newline_before_ = true;
+    if (c == '*' && Check('/')) return true;
+  }
+}
+
+void TopLevelFunctionScanner::SkipLineComment() {
+  while (true) {
+    base::uc32 c = stream_->Peek();
+    if (c == kEndOfInput || IsLineTerminator(c)) return;
+    stream_->Advance();
+  }
+}
+
+}  // namespace
+
+class ParallelPreparser::JobTask : public v8::JobTask {
+ public:
+  explicit JobTask(ParallelPreparser* preparser) : preparser_(preparser) {}
+
+  void Run(JobDelegate* delegate) final { preparser_->Run(delegate); }
+
+  size_t GetMaxConcurrency(size_t worker_count) const final {
+    return preparser_->GetMaxConcurrency();
+  }
+
+ private:
+  ParallelPreparser* const preparser_;
+};
+
+// static
+std::unique_ptr<ParallelPreparser> ParallelPreparser::MaybeStart(
+    Isolate* isolate, ParseInfo* info, Handle<String> source) {
+  const UnoptimizedCompileFlags& flags = info->flags();
+  // The workers have no logger to report function events to.
+  if (!v8_flags.parallel_preparse || v8_flags.log_function_events) {
+    return nullptr;
+  }
+  if (!flags.is_toplevel() || flags.is_eval() || flags.is_module() ||
+      flags.is_repl_mode() || info->is_wrapped_as_function()) {
+    return nullptr;
+  }
+  if (source->length() < v8_flags.parallel_preparse_min_source_size * KB) {
+    return nullptr;
+  }
+
+  std::unique_ptr<uint8_t[]> owned_source;
+  std::unique_ptr<Utf16CharacterStream> stream;
+  if (info->character_stream()->can_be_cloned_for_parallel_access()) {
+    stream = info->character_stream()->Clone();
+  } else {
+    // On-heap sources may move; the workers read from an off-heap copy.
+    source = String::Flatten(isolate, source);
+    DisallowGarbageCollection no_gc;
+    String::FlatContent content = source->GetFlatContent(no_gc);
+    if (content.IsOneByte()) {
+      base::Vector<const uint8_t> chars = content.ToOneByteVector();
+      owned_source.reset(new uint8_t[chars.length()]);
+      std::copy(chars.begin(), chars.end(), owned_source.get());
+      stream = ScannerStream::ForOffHeapBuffer(owned_source.get(),
+                                               chars.length());
+    } else {
+      base::Vector<const base::uc16> chars = content.ToUC16Vector();
+      owned_source.reset(new uint8_t[chars.length() * sizeof(base::uc16)]);
+      uint16_t* copy = reinterpret_cast<uint16_t*>(owned_source.get());
+      std::copy(chars.begin(), chars.end(), copy);
+      stream = ScannerStream::ForOffHeapBuffer(copy, chars.length());
+    }
+  }
+
+  std::unique_ptr<ParallelPreparser> preparser(new ParallelPreparser(
+      info, std::move(stream), std::move(owned_source)));
+  preparser->job_handle_ = V8::GetCurrentPlatform()->PostJob(
+      TaskPriority::kUserBlocking,
+      std::make_unique<JobTask>(preparser.get()));
+  return preparser;
+}
+
+ParallelPreparser::ParallelPreparser(
+    ParseInfo* info, std::unique_ptr<Utf16CharacterStream> stream,
+    std::unique_ptr<uint8_t[]> owned_source)
+    : flags_(info->flags()),
+      allocator_(info->allocator()),
+      ast_string_constants_(info->ast_string_constants()),
+      hash_seed_(info->hash_seed()),
+      owned_source_(std::move(owned_source)),
+      stream_(std::move(stream)) {}
+
+ParallelPreparser::~ParallelPreparser() { Cancel(); }
+
+void ParallelPreparser::Cancel() {
+  if (!job_handle_) return;
+  cancelled_.store(true, std::memory_order_relaxed);
+  next_function_.store(-1, std::memory_order_relaxed);
+  job_handle_->Cancel();
+  job_handle_.reset();
+}
+
+bool ParallelPreparser::TakeFunction(int start_position, FunctionKind kind,
+                                     LanguageMode outer_language_mode,
+                                     FunctionData* data) {
+  // Workers stop at functions the parser has passed.
+  parser_position_.store(start_position, std::memory_order_relaxed);
+  if (!split_done_.load(std::memory_order_acquire)) return false;
+
+  Function* begin = functions_.get();
+  Function* end = begin + function_count_;
+  Function* function = std::lower_bound(
+      begin, end, start_position,
+      [](const Function& f, int position) {
+        return f.start_position < position;
+      });
+  if (function == end || function->start_position != start_position) {
+    return false;
+  }
+
+  State state = function->state.load(std::memory_order_acquire);
+  if (state == State::kPending) {
+    // No worker got to it yet; the parser preparses it itself.
+    function->state.compare_exchange_strong(state, State::kTaken,
+                                            std::memory_order_relaxed);
+    return false;
+  }
+  if (state != State::kDone) return false;
+  function->state.store(State::kTaken, std::memory_order_relaxed);
+  // The workers guessed the function kind and the outer language mode.
+  if (function->kind != kind || language_mode_ != outer_language_mode) {
+    return false;
+  }
+  *data = std::move(function->data);
+  return true;
+}
+
+size_t ParallelPreparser::GetMaxConcurrency() const {
+  if (cancelled_.load(std::memory_order_relaxed)) return 0;
+  if (!split_done_.load(std::memory_order_acquire)) return 1;
+  int remaining = next_function_.load(std::memory_order_relaxed) + 1;
+  if (remaining <= 0) return 0;
+  size_t max_threads = v8_flags.parallel_preparse_max_threads;
+  if (max_threads == 0) return remaining;
+  return std::min(static_cast<size_t>(remaining), max_threads);
+}
+
+void ParallelPreparser::Run(JobDelegate* delegate) {
+  if (!split_done_.load(std::memory_order_acquire)) {
+    base::MutexGuard guard(&split_mutex_);
+    if (!split_done_.load(std::memory_order_relaxed)) {
+      Split();
+      split_done_.store(true, std::memory_order_release);
+      delegate->NotifyConcurrencyIncrease();
+    }
+  }
+
+  std::unique_ptr<Utf16CharacterStream> stream = stream_->Clone();
+  while (!delegate->ShouldYield()) {
+    int index = next_function_.fetch_sub(1, std::memory_order_relaxed);
+    if (index < 0) return;
+    Function* function = &functions_[index];
+    if (function->start_position <=
+        parser_position_.load(std::memory_order_relaxed)) {
+      // The parser has passed this function and all earlier ones.
+      next_function_.store(-1, std::memory_order_relaxed);
+      return;
+    }
+    State expected = State::kPending;
+    if (!function->state.compare_exchange_strong(expected, State::kRunning,
+                                                 std::memory_order_relaxed)) {
+      continue;
+    }
+    bool success = PreparseFunction(stream.get(), function);
+    function->state.store(success ? State::kDone : State::kFailed,
+                          std::memory_order_release);
+  }
+}
+
+void ParallelPreparser::Split() {
+  std::unique_ptr<Utf16CharacterStream> stream = stream_->Clone();
+  std::vector<TopLevelFunctionScanner::Function> candidates;
+  TopLevelFunctionScanner scanner(stream.get(), &cancelled_);
+  if (!scanner.Scan(&candidates, &language_mode_)) return;
+  if (candidates.empty()) return;
+
+  function_count_ = static_cast<int>(candidates.size());
+  functions_.reset(new Function[function_count_]);
+  for (int i = 0; i < function_count_; i++) {
+    functions_[i].start_position = candidates[i].start_position;
+    functions_[i].kind = candidates[i].kind;
+  }
+  next_function_.store(function_count_ - 1, std::memory_order_relaxed);
+}
+
+bool ParallelPreparser::PreparseFunction(Utf16CharacterStream* stream,
+                                         Function* function) {
+  stream->Seek(function->start_position);
+  Scanner scanner(stream, flags_);
+  scanner.Initialize();
+  if (scanner.Next() != Token::LPAREN ||
+      scanner.location().beg_pos != function->start_position) {
+    return false;
+  }
+
+  Zone zone(allocator_, ZONE_NAME);
+  AstValueFactory ast_value_factory(&zone, ast_string_constants_, hash_seed_);
+  PendingCompilationErrorHandler pending_error_handler;
+  const uintptr_t stack_limit =
+      GetCurrentStackPosition() - v8_flags.stack_size * KB;
+  PreParser preparser(&zone, &scanner, stack_limit, &ast_value_factory,
+                      &pending_error_handler, nullptr, nullptr, flags_, false);
+
+  DeclarationScope* script_scope =
+      zone.New<DeclarationScope>(&zone, &ast_value_factory);
+  script_scope->SetLanguageMode(language_mode_);
+  DeclarationScope* function_scope = zone.New<DeclarationScope>(
+      &zone, script_scope, FUNCTION_SCOPE, function->kind);
+  function_scope->SetLanguageMode(language_mode_);
+  function_scope->set_start_position(function->start_position);
+
+  int use_counts[v8::Isolate::kUseCounterFeatureCount] = {};
+  ProducedPreparseData* produced_preparse_data = nullptr;
+  // The name only matters for named function expressions, whose name is
+  // declared in the function's own scope.
+  PreParser::PreParseResult result = preparser.PreParseFunction(
+      nullptr, function->kind, FunctionSyntaxKind::kAnonymousExpression,
+      function_scope, use_counts, &produced_preparse_data);
+  // The parser preparses functions with errors itself, to report them.
+  if (result != PreParser::kPreParseSuccess || preparser.has_error() ||
+      pending_error_handler.has_pending_error() ||
+      pending_error_handler.has_error_unidentifiable_by_preparser()) {
+    return false;
+  }
+
+  FunctionData* data = &function->data;
+  PreParserLogger* logger = preparser.logger();
+  data->end_position = logger->end();
+  data->num_parameters = logger->num_parameters();
+  data->function_length = logger->function_length();
+  data->num_inner_functions = logger->num_inner_functions();
+  data->language_mode = function_scope->language_mode();
+  data->allow_eval_cache = preparser.allow_eval_cache();
+  for (int feature = 0; feature < v8::Isolate::kUseCounterFeatureCount;
+       feature++) {
+    data->use_counts.insert(
+        data->use_counts.end(), use_counts[feature],
+        static_cast<v8::Isolate::UseCounterFeature>(feature));
+  }
+  return true;
+}
+
+}  // namespace internal
+}  // namespace v8
@@ -0,0 +1,123 @@
+// Copyright 2024 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#ifndef V8_PARSING_PARALLEL_PREPARSER_H_
+#define V8_PARSING_PARALLEL_PREPARSER_H_
+
+#include <atomic>
+#include <memory>
+#include <vector>
+
+#include "include/v8-isolate.h"
+#include "include/v8-platform.h"
+#include "src/base/platform/mutex.h"
+#include "src/common/globals.h"
+#include "src/objects/function-kind.h"
+#include "src/parsing/parse-info.h"
+
+namespace v8 {
+namespace internal {
+
+class AccountingAllocator;
+class AstStringConstants;
+class Utf16CharacterStream;
+
+// Preparses the top-level functions of a large classic script on worker
+// threads while the main thread parses the script.
+//
+// A quick scan over the source, which only understands braces, strings,
+// comments, template and regexp literals, finds the functions at brace depth
+// zero. Workers then preparse these functions from the end of the script
+// towards its start, each on its own scanner, and record what the parser needs
+// to skip them: the end position, the parameter counts, the number of inner
+// function literals, and the language mode. When the parser reaches a
+// function that a worker has finished, it skips the function body like it
+// would with consumed preparse data; otherwise it preparses the function
+// itself. A mistake of the quick scan can therefore only cost time, and a
+// script that the quick scan cannot make sense of is parsed sequentially.
+//
+// Only functions whose outer scope is the script scope are skipped, since only
+// those do not need their free variables analyzed (see
+// DeclarationScope::AnalyzePartially).
+class ParallelPreparser final {
+ public:
+  struct FunctionData {
+    int end_position;
+    int num_parameters;
+    int function_length;
+    int num_inner_functions;
+    LanguageMode language_mode;
+    bool allow_eval_cache;
+    // The use counter features the preparser hit, one entry per hit.
+    std::vector<v8::Isolate::UseCounterFeature> use_counts;
+  };
+
+  // Starts preparsing the top-level functions of {source} if it is worth it,
+  // and returns nullptr otherwise.
+  static std::unique_ptr<ParallelPreparser> MaybeStart(Isolate* isolate,
+                                                       ParseInfo* info,
+                                                       Handle<String> source);
+
+  ~ParallelPreparser();
+  ParallelPreparser(const ParallelPreparser&) = delete;
+  ParallelPreparser& operator=(const ParallelPreparser&) = delete;
+
+  // Called by the parser for a function starting at {start_position} that it
+  // is about to preparse. Returns true and fills {data} if a worker has
+  // already preparsed it with the same {kind} and {outer_language_mode}.
+  bool TakeFunction(int start_position, FunctionKind kind,
+                    LanguageMode outer_language_mode, FunctionData* data);
+
+  // Stops all workers and waits for them. The parser calls this when it is
+  // done with the script.
+  void Cancel();
+
+ private:
+  class JobTask;
+
+  enum class State : uint8_t { kPending, kRunning, kDone, kFailed, kTaken };
+
+  struct Function {
+    int start_position;
+    FunctionKind kind;
+    std::atomic<State> state{State::kPending};
+    FunctionData data;
+  };
+
+  ParallelPreparser(ParseInfo* info,
+                    std::unique_ptr<Utf16CharacterStream> stream,
+                    std::unique_ptr<uint8_t[]> owned_source);
+
+  void Run(JobDelegate* delegate);
+  size_t GetMaxConcurrency() const;
+  void Split();
+  bool PreparseFunction(Utf16CharacterStream* stream, Function* function);
+
+  const UnoptimizedCompileFlags flags_;
+  AccountingAllocator* const allocator_;
+  const AstStringConstants* const ast_string_constants_;
+  const uint64_t hash_seed_;
+  // Keeps a copy of an on-heap source alive for {stream_} and its clones.
+  std::unique_ptr<uint8_t[]> owned_source_;
+  std::unique_ptr<Utf16CharacterStream> stream_;
+
+  base::Mutex split_mutex_;
+  std::atomic<bool> split_done_{false};
+  std::atomic<bool> cancelled_{false};
+  // The outer language mode the workers assume; see TakeFunction.
+  LanguageMode language_mode_ = LanguageMode::kSloppy;
+  // Sorted by start position. Written once by Split.
+  std::unique_ptr<Function[]> functions_;
+  int function_count_ = 0;
+  // Workers take functions from the end; the parser moves from the start.
+  std::atomic<int> next_function_{-1};
+  std::atomic<int> parser_position_{0};
+
+  std::unique_ptr<JobHandle> job_handle_;
+};
+
+}  // namespace internal
+}  // namespace v8
+
+#endif  // V8_PARSING_PARALLEL_PREPARSER_H_
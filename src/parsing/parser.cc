@@ -587,7 +587,12 @@ void Parser::ParseProgram(Isolate* isolate, Handle<Script> script,
   }
 
   scanner_.Initialize();
+  if (allow_lazy_ && consumed_preparse_data_ == nullptr) {
+    parallel_preparser_ = ParallelPreparser::MaybeStart(
+        isolate, info, handle(String::cast(script->source()), isolate));
+  }
   FunctionLiteral* result = DoParseProgram(isolate, info);
+  if (parallel_preparser_) parallel_preparser_->Cancel();
   MaybeProcessSourceRanges(info, result, stack_limit_);
   PostProcessParseResult(isolate, info, result);
 
@@ -2908,6 +2913,35 @@ bool Parser::SkipFunction(const AstRawString* function_name, FunctionKind kind,
     return true;
   }
 
+  // Top-level functions need no partial scope analysis (see
+  // DeclarationScope::AnalyzePartially), so a function that a worker has
+  // preparsed can be skipped with just its skip data. The inner functions
+  // get no preparse data and are preparsed again when the function is
+  // compiled.
+  ParallelPreparser::FunctionData parallel_data;
+  if (parallel_preparser_ && function_scope->outer_scope()->is_script_scope() &&
+      !MaybeParsingArrowhead() &&
+      parallel_preparser_->TakeFunction(function_scope->start_position(), kind,
+                                        function_scope->language_mode(),
+                                        &parallel_data)) {
+    function_scope->set_end_position(parallel_data.end_position);
+    scanner()->SeekForward(parallel_data.end_position - 1);
+    Expect(Token::RBRACE);
+    // The worker has counted the use of strict mode already.
+    function_scope->SetLanguageMode(parallel_data.language_mode);
+    if (!parallel_data.allow_eval_cache) set_allow_eval_cache(false);
+    for (v8::Isolate::UseCounterFeature feature : parallel_data.use_counts) {
+      ++use_counts_[feature];
+    }
+    total_preparse_skipped_ +=
+        function_scope->end_position() - function_scope->start_position();
+    *num_parameters = parallel_data.num_parameters;
+    *function_length = parallel_data.function_length;
+    SkipFunctionLiterals(parallel_data.num_inner_functions);
+    function_scope->ResetAfterPreparsing(ast_value_factory_, false);
+    return true;
+  }
+
   Scanner::BookmarkScope bookmark(scanner());
   bookmark.Set(function_scope->start_position());
 
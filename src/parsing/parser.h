@@ -17,6 +17,7 @@
 #include "src/base/threaded-list.h"
 #include "src/common/globals.h"
 #include "src/parsing/import-assertions.h"
+#include "src/parsing/parallel-preparser.h"
 #include "src/parsing/parse-info.h"
 #include "src/parsing/parser-base.h"
 #include "src/parsing/parsing.h"
@@ -1143,6 +1144,8 @@ class V8_EXPORT_PRIVATE Parser : public NON_EXPORTED_BASE(ParserBase<Parser>) {
   bool temp_zoned_;
   ConsumedPreparseData* consumed_preparse_data_;
   std::vector<uint8_t> preparse_data_buffer_;
+  // Preparses top-level functions ahead of the parser, see SkipFunction.
+  std::unique_ptr<ParallelPreparser> parallel_preparser_;
 
   // If not kNoSourcePosition, indicates that the first function literal
   // encountered is a dynamic function, see CreateDynamicFunction(). This field
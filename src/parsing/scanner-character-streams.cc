@@ -127,11 +127,11 @@ class ExternalStringStream {
   const size_t length_;
 };
 
-// A Char stream backed by a C array. Testing only.
+// A Char stream backed by a C array that the caller keeps alive.
 template <typename Char>
-class TestingStream {
+class BufferStream {
  public:
-  TestingStream(const Char* data, size_t length)
+  BufferStream(const Char* data, size_t length)
       : data_(data), length_(length) {}
   // The no_gc argument is only here because of the templated way this class
   // is used along with other implementations that require V8 heap access.
@@ -914,7 +914,7 @@ std::unique_ptr<Utf16CharacterStream> ScannerStream::ForTesting(
   }
 
   return std::unique_ptr<Utf16CharacterStream>(
-      new BufferedCharacterStream<TestingStream>(
+      new BufferedCharacterStream<BufferStream>(
           0, reinterpret_cast<const uint8_t*>(data), length));
 }
 
@@ -931,7 +931,21 @@ std::unique_ptr<Utf16CharacterStream> ScannerStream::ForTesting(
   }
 
   return std::unique_ptr<Utf16CharacterStream>(
-      new UnbufferedCharacterStream<TestingStream>(0, data, length));
+      new UnbufferedCharacterStream<BufferStream>(0, data, length));
+}
+
+std::unique_ptr<Utf16CharacterStream> ScannerStream::ForOffHeapBuffer(
+    const uint8_t* data, size_t length) {
+  DCHECK_NOT_NULL(data);
+  return std::unique_ptr<Utf16CharacterStream>(
+      new BufferedCharacterStream<BufferStream>(0, data, length));
+}
+
+std::unique_ptr<Utf16CharacterStream> ScannerStream::ForOffHeapBuffer(
+    const uint16_t* data, size_t length) {
+  DCHECK_NOT_NULL(data);
+  return std::unique_ptr<Utf16CharacterStream>(
+      new UnbufferedCharacterStream<BufferStream>(0, data, length));
 }
 
 Utf16CharacterStream* ScannerStream::For(
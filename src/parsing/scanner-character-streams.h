@@ -25,6 +25,13 @@ class V8_EXPORT_PRIVATE ScannerStream {
       ScriptCompiler::ExternalSourceStream* source_stream,
       ScriptCompiler::StreamedSource::Encoding encoding);
 
+  // Streams over characters that the caller keeps alive for the lifetime of
+  // the stream and all of its clones.
+  static std::unique_ptr<Utf16CharacterStream> ForOffHeapBuffer(
+      const uint8_t* data, size_t length);
+  static std::unique_ptr<Utf16CharacterStream> ForOffHeapBuffer(
+      const uint16_t* data, size_t length);
+
   static std::unique_ptr<Utf16CharacterStream> ForTesting(const char* data);
   static std::unique_ptr<Utf16CharacterStream> ForTesting(const char* data,
                                                           size_t length);
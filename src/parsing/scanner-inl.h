@@ -6,6 +6,7 @@
 #define V8_PARSING_SCANNER_INL_H_
 
 #include "src/parsing/keywords-gen.h"
+#include "src/parsing/scanner-simd.h"
 #include "src/parsing/scanner.h"
 #include "src/strings/char-predicates-inl.h"
 #include "src/utils/utils.h"
@@ -275,6 +276,16 @@ V8_INLINE Token::Value Scanner::ScanIdentifierOrKeywordInner() {
       // Otherwise we'll fall into the slow path after scanning the identifier.
       DCHECK(!IdentifierNeedsSlowPath(scan_flags));
       AddLiteralChar(static_cast<char>(c0_));
+      // Copy the ASCII part of the identifier in bulk. Only identifiers that
+      // are short enough can be keywords.
+      base::Vector<const uint16_t> run =
+          source_->AdvanceRun(&FindNonAsciiIdentifierPart);
+      next().literal_chars.AddAsciiChars(run);
+      if (run.length() >= MAX_WORD_LENGTH) {
+        scan_flags |= static_cast<uint8_t>(ScanFlags::kCannotBeKeyword);
+      } else {
+        for (uint16_t c : run) scan_flags |= character_scan_flags[c];
+      }
       AdvanceUntil([this, &scan_flags](base::uc32 c0) {
         if (V8_UNLIKELY(static_cast<uint32_t>(c0) > kMaxAscii)) {
           // A non-ascii character means we need to drop through to the slow
@@ -327,7 +338,11 @@ V8_INLINE Token::Value Scanner::SkipWhiteSpace() {
     next().after_line_terminator = true;
   }
 
-  // Advance as long as character is a WhiteSpace or LineTerminator.
+  // Advance as long as character is a WhiteSpace or LineTerminator. Runs of
+  // spaces, like indentation, are skipped in bulk first.
+  source_->AdvanceRun([](const uint16_t* start, const uint16_t* end) {
+    return FindCharacterOtherThan(start, end, ' ');
+  });
   base::uc32 hint = ' ';
   AdvanceUntil([this, &hint](base::uc32 c0) {
     if (V8_LIKELY(c0 == hint)) return false;
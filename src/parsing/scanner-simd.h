@@ -0,0 +1,188 @@
+// Copyright 2024 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#ifndef V8_PARSING_SCANNER_SIMD_H_
+#define V8_PARSING_SCANNER_SIMD_H_
+
+#include <cstdint>
+
+#include "src/strings/string-simd.h"
+
+namespace v8 {
+namespace internal {
+
+// Helpers for the scanner to find the end of a run of "plain" code units in
+// its UTF-16 buffer, several code units at a time where SIMD is available.
+// They may stop early on a code unit that is not interesting to the caller,
+// so the caller has to continue on its own slow path from the returned
+// position.
+
+// Matches code units that are not printable ASCII (0x20 to 0x7E) or that are
+// {a} or {b}.
+class NonPlainAsciiCharacterMatcher {
+ public:
+  NonPlainAsciiCharacterMatcher(char a, char b) : a_(a), b_(b) {}
+
+  bool operator()(uint16_t c) const {
+    return c < 0x20 || c > 0x7E || c == a_ || c == b_;
+  }
+#ifdef __SSE3__
+  __m128i operator()(__m128i chars) const {
+    // The comparisons are signed, so code units from 0x8000 up count as less
+    // than 0x20.
+    __m128i stop = _mm_or_si128(_mm_cmplt_epi16(chars, _mm_set1_epi16(0x20)),
+                                _mm_cmpgt_epi16(chars, _mm_set1_epi16(0x7E)));
+    stop = _mm_or_si128(stop, _mm_cmpeq_epi16(chars, _mm_set1_epi16(a_)));
+    return _mm_or_si128(stop, _mm_cmpeq_epi16(chars, _mm_set1_epi16(b_)));
+  }
+#endif
+#ifdef V8_STRING_SIMD_AVX2
+  V8_TARGET_AVX2 __m256i operator()(__m256i chars) const {
+    __m256i stop =
+        _mm256_or_si256(_mm256_cmpgt_epi16(_mm256_set1_epi16(0x20), chars),
+                        _mm256_cmpgt_epi16(chars, _mm256_set1_epi16(0x7E)));
+    stop = _mm256_or_si256(stop,
+                           _mm256_cmpeq_epi16(chars, _mm256_set1_epi16(a_)));
+    return _mm256_or_si256(stop,
+                           _mm256_cmpeq_epi16(chars, _mm256_set1_epi16(b_)));
+  }
+#endif
+#ifdef NEON64
+  uint16x8_t operator()(uint16x8_t chars) const {
+    uint16x8_t stop = vorrq_u16(vcltq_u16(chars, vdupq_n_u16(0x20)),
+                                vcgtq_u16(chars, vdupq_n_u16(0x7E)));
+    stop = vorrq_u16(stop, vceqq_u16(chars, vdupq_n_u16(a_)));
+    return vorrq_u16(stop, vceqq_u16(chars, vdupq_n_u16(b_)));
+  }
+#endif
+
+ private:
+  const char a_;
+  const char b_;
+};
+
+// Matches code units that are {c}, or with {negate} all others.
+class CharacterMatcher {
+ public:
+  CharacterMatcher(char c, bool negate) : c_(c), negate_(negate) {}
+
+  bool operator()(uint16_t c) const { return (c == c_) != negate_; }
+#ifdef __SSE3__
+  __m128i operator()(__m128i chars) const {
+    __m128i found = _mm_cmpeq_epi16(chars, _mm_set1_epi16(c_));
+    return negate_ ? _mm_xor_si128(found, _mm_set1_epi16(-1)) : found;
+  }
+#endif
+#ifdef V8_STRING_SIMD_AVX2
+  V8_TARGET_AVX2 __m256i operator()(__m256i chars) const {
+    __m256i found = _mm256_cmpeq_epi16(chars, _mm256_set1_epi16(c_));
+    return negate_ ? _mm256_xor_si256(found, _mm256_set1_epi16(-1)) : found;
+  }
+#endif
+#ifdef NEON64
+  uint16x8_t operator()(uint16x8_t chars) const {
+    uint16x8_t found = vceqq_u16(chars, vdupq_n_u16(c_));
+    return negate_ ? vmvnq_u16(found) : found;
+  }
+#endif
+
+ private:
+  const char c_;
+  const bool negate_;
+};
+
+// Matches code units that are not ASCII identifier parts ([0-9A-Za-z_$]).
+struct NonAsciiIdentifierPartMatcher {
+  bool operator()(uint16_t c) const {
+    uint16_t lower_cased = c | 0x20;
+    bool is_part = (lower_cased >= 'a' && lower_cased <= 'z') ||
+                   (c >= '0' && c <= '9') || c == '_' || c == '$';
+    return !is_part;
+  }
+#ifdef __SSE3__
+  __m128i operator()(__m128i chars) const {
+    // Setting the lower case bit maps upper case letters onto lower case
+    // ones and nothing else onto letters. Code units from 0x8000 up are
+    // negative and fail both range checks.
+    __m128i lower_cased = _mm_or_si128(chars, _mm_set1_epi16(0x20));
+    __m128i letter =
+        _mm_and_si128(_mm_cmpgt_epi16(lower_cased, _mm_set1_epi16('a' - 1)),
+                      _mm_cmplt_epi16(lower_cased, _mm_set1_epi16('z' + 1)));
+    __m128i digit =
+        _mm_and_si128(_mm_cmpgt_epi16(chars, _mm_set1_epi16('0' - 1)),
+                      _mm_cmplt_epi16(chars, _mm_set1_epi16('9' + 1)));
+    __m128i part = _mm_or_si128(letter, digit);
+    part = _mm_or_si128(part, _mm_cmpeq_epi16(chars, _mm_set1_epi16('_')));
+    part = _mm_or_si128(part, _mm_cmpeq_epi16(chars, _mm_set1_epi16('$')));
+    return _mm_xor_si128(part, _mm_set1_epi16(-1));
+  }
+#endif
+#ifdef V8_STRING_SIMD_AVX2
+  V8_TARGET_AVX2 __m256i operator()(__m256i chars) const {
+    __m256i lower_cased = _mm256_or_si256(chars, _mm256_set1_epi16(0x20));
+    __m256i letter = _mm256_and_si256(
+        _mm256_cmpgt_epi16(lower_cased, _mm256_set1_epi16('a' - 1)),
+        _mm256_cmpgt_epi16(_mm256_set1_epi16('z' + 1), lower_cased));
+    __m256i digit = _mm256_and_si256(
+        _mm256_cmpgt_epi16(chars, _mm256_set1_epi16('0' - 1)),
+        _mm256_cmpgt_epi16(_mm256_set1_epi16('9' + 1), chars));
+    __m256i part = _mm256_or_si256(letter, digit);
+    part = _mm256_or_si256(part,
+                           _mm256_cmpeq_epi16(chars, _mm256_set1_epi16('_')));
+    part = _mm256_or_si256(part,
+                           _mm256_cmpeq_epi16(chars, _mm256_set1_epi16('$')));
+    return _mm256_xor_si256(part, _mm256_set1_epi16(-1));
+  }
+#endif
+#ifdef NEON64
+  uint16x8_t operator()(uint16x8_t chars) const {
+    uint16x8_t lower_cased = vorrq_u16(chars, vdupq_n_u16(0x20));
+    uint16x8_t letter =
+        vandq_u16(vcgtq_u16(lower_cased, vdupq_n_u16('a' - 1)),
+                  vcltq_u16(lower_cased, vdupq_n_u16('z' + 1)));
+    uint16x8_t digit = vandq_u16(vcgtq_u16(chars, vdupq_n_u16('0' - 1)),
+                                 vcltq_u16(chars, vdupq_n_u16('9' + 1)));
+    uint16x8_t part = vorrq_u16(letter, digit);
+    part = vorrq_u16(part, vceqq_u16(chars, vdupq_n_u16('_')));
+    part = vorrq_u16(part, vceqq_u16(chars, vdupq_n_u16('$')));
+    return vmvnq_u16(part);
+  }
+#endif
+};
+
+// Returns the first code unit in [start, end) that is not printable ASCII
+// (0x20 to 0x7E) or that is {a} or {b}, or {end} if there is none.
+inline const uint16_t* FindNonPlainAsciiCharacter(const uint16_t* start,
+                                                  const uint16_t* end, char a,
+                                                  char b) {
+  return FindFirstMatchingCharacter(start, end,
+                                    NonPlainAsciiCharacterMatcher(a, b));
+}
+
+// Returns the first code unit in [start, end) that is {c}, or {end} if there
+// is none.
+inline const uint16_t* FindCharacter(const uint16_t* start,
+                                     const uint16_t* end, char c) {
+  return FindFirstMatchingCharacter(start, end, CharacterMatcher(c, false));
+}
+
+// Returns the first code unit in [start, end) that is not {c}, or {end} if
+// there is none.
+inline const uint16_t* FindCharacterOtherThan(const uint16_t* start,
+                                              const uint16_t* end, char c) {
+  return FindFirstMatchingCharacter(start, end, CharacterMatcher(c, true));
+}
+
+// Returns the first code unit in [start, end) that is not an ASCII
+// identifier part ([0-9A-Za-z_$]), or {end} if there is none.
+inline const uint16_t* FindNonAsciiIdentifierPart(const uint16_t* start,
+                                                  const uint16_t* end) {
+  return FindFirstMatchingCharacter(start, end,
+                                    NonAsciiIdentifierPartMatcher());
+}
+
+}  // namespace internal
+}  // namespace v8
+
+#endif  // V8_PARSING_SCANNER_SIMD_H_
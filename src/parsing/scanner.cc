@@ -16,6 +16,7 @@
 #include "src/objects/bigint.h"
 #include "src/parsing/parse-info.h"
 #include "src/parsing/scanner-inl.h"
+#include "src/parsing/scanner-simd.h"
 #include "src/zone/zone.h"
 
 namespace v8 {
@@ -210,6 +211,9 @@ Token::Value Scanner::SkipSingleLineComment() {
   // separately by the lexical grammar and becomes part of the
   // stream of input elements for the syntactic grammar (see
   // ECMA-262, section 7.4).
+  source_->AdvanceRun([](const uint16_t* start, const uint16_t* end) {
+    return FindNonPlainAsciiCharacter(start, end, '\0', '\0');
+  });
   AdvanceUntil([](base::uc32 c0) { return unibrow::IsLineTerminator(c0); });
 
   return Token::WHITESPACE;
@@ -290,6 +294,9 @@ Token::Value Scanner::SkipMultiLineComment() {
   // Until we see the first newline, check for * and newline characters.
   if (!next().after_line_terminator) {
     do {
+      source_->AdvanceRun([](const uint16_t* start, const uint16_t* end) {
+        return FindNonPlainAsciiCharacter(start, end, '*', '*');
+      });
       AdvanceUntil([](base::uc32 c0) {
         if (V8_UNLIKELY(static_cast<uint32_t>(c0) > kMaxAscii)) {
           return unibrow::IsLineTerminator(c0);
@@ -315,6 +322,9 @@ Token::Value Scanner::SkipMultiLineComment() {
 
   // After we've seen newline, simply try to find '*/'.
   while (c0_ != kEndOfInput) {
+    source_->AdvanceRun([](const uint16_t* start, const uint16_t* end) {
+      return FindCharacter(start, end, '*');
+    });
     AdvanceUntil([](base::uc32 c0) { return c0 == '*'; });
 
     while (c0_ == '*') {
@@ -469,6 +479,13 @@ Token::Value Scanner::ScanString() {
 
   next().literal_chars.Start();
   while (true) {
+    // Copy runs of printable ASCII in bulk; AdvanceUntil takes care of the
+    // rest.
+    next().literal_chars.AddAsciiChars(source_->AdvanceRun(
+        [quote](const uint16_t* start, const uint16_t* end) {
+          return FindNonPlainAsciiCharacter(start, end,
+                                            static_cast<char>(quote), '\\');
+        }));
     AdvanceUntil([this](base::uc32 c0) {
       if (V8_UNLIKELY(static_cast<uint32_t>(c0) > kMaxAscii)) {
         if (V8_UNLIKELY(unibrow::IsStringLiteralLineTerminator(c0))) {
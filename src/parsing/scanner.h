@@ -95,6 +95,18 @@ class Utf16CharacterStream {
     }
   }
 
+  // Advances past the code units in the current buffer up to the one that
+  // {find}(cursor, end) returns, and returns them. Does not read a new
+  // buffer, so callers follow up with AdvanceUntil.
+  template <typename FindFunction>
+  V8_INLINE base::Vector<const uint16_t> AdvanceRun(FindFunction find) {
+    const uint16_t* run_start = buffer_cursor_;
+    buffer_cursor_ = find(buffer_cursor_, buffer_end_);
+    DCHECK_LE(buffer_cursor_, buffer_end_);
+    return base::Vector<const uint16_t>(run_start,
+                                        buffer_cursor_ - run_start);
+  }
+
   // Go back one by one character in the input stream.
   // This undoes the most recent Advance().
   inline void Back() {
@@ -4,6 +4,8 @@
 
 #include "src/regexp/experimental/experimental-interpreter.h"
 
+#include <cstring>
+
 #include "src/base/optional.h"
 #include "src/base/strings.h"
 #include "src/common/assert-scope.h"
@@ -156,6 +158,7 @@ class NfaInterpreter {
         best_match_registers_(base::nullopt),
         lookbehind_pc_(0, zone),
         lookbehind_table_(0, zone),
+        start_ranges_(0, zone),
         zone_(zone) {
     DCHECK(!bytecode_.empty());
     DCHECK_GE(input_index_, 0);
@@ -177,6 +180,8 @@ class NfaInterpreter {
 
     std::fill(pc_last_input_index_.begin(), pc_last_input_index_.end(),
               LastInputIndex());
+
+    InitializeFastForward();
   }
 
   // Finds matches and writes their concatenated capture registers to
@@ -393,6 +398,10 @@ class NfaInterpreter {
     while (input_index_ != input_.length() &&
            !(FoundMatch() && blocked_threads_.is_empty())) {
       DCHECK(active_threads_.is_empty());
+      if (CanFastForward()) {
+        FastForward();
+        if (input_index_ == input_.length()) break;
+      }
       base::uc16 input_char = input_[input_index_];
       ++input_index_;
 
@@ -553,6 +562,169 @@ class NfaInterpreter {
 
   bool FoundMatch() const { return best_match_registers_.has_value(); }
 
+  // Unanchored regexps start with the /.*?/ preamble emitted by
+  // `CompileNonGreedyStar`, which has a fixed layout:
+  //
+  //   0: FORK 2
+  //   1: JMP 6
+  //   2: BEGIN_LOOP
+  //   3: CONSUME_RANGE [0x0000, 0xFFFF]
+  //   4: END_LOOP
+  //   5: FORK 2
+  static constexpr int kPreambleConsumePc = 3;
+  static constexpr int kPreambleLength = 6;
+
+  bool HasUnanchoredPreamble() const {
+    if (bytecode_.length() <= kPreambleLength) return false;
+    RegExpInstruction any_char = RegExpInstruction::ConsumeAnyChar();
+    return bytecode_[0].opcode == RegExpInstruction::FORK &&
+           bytecode_[0].payload.pc == 2 &&
+           bytecode_[1].opcode == RegExpInstruction::JMP &&
+           bytecode_[1].payload.pc == kPreambleLength &&
+           bytecode_[2].opcode == RegExpInstruction::BEGIN_LOOP &&
+           bytecode_[3].opcode == RegExpInstruction::CONSUME_RANGE &&
+           bytecode_[3].payload.consume_range.min ==
+               any_char.payload.consume_range.min &&
+           bytecode_[3].payload.consume_range.max ==
+               any_char.payload.consume_range.max &&
+           bytecode_[4].opcode == RegExpInstruction::END_LOOP &&
+           bytecode_[5].opcode == RegExpInstruction::FORK &&
+           bytecode_[5].payload.pc == 2;
+  }
+
+  // While no match has been found, the preamble thread restarts the match
+  // attempt at every input position.  As long as the only other threads are
+  // blocked at one of the CONSUME_RANGEs that such an attempt begins with,
+  // every character that none of those ranges accepts leaves us in exactly the
+  // state of a fresh attempt at the next position.  This is what the
+  // interpreter spends most of its time on for patterns that rarely match, so
+  // we compute the set of characters that can start a match once and skip
+  // over all others in a tight loop instead of simulating the NFA for them.
+  //
+  // This is only done if the start of a match doesn't depend on the input
+  // position (no assertions or lookbehinds) and a match can't be empty.
+  void InitializeFastForward() {
+    if (!lookbehind_pc_.is_empty() || !HasUnanchoredPreamble()) return;
+
+    is_start_consume_pc_ = zone_->AllocateVector<bool>(bytecode_.length());
+    std::fill(is_start_consume_pc_.begin(), is_start_consume_pc_.end(), false);
+    base::Vector<bool> visited =
+        zone_->AllocateVector<bool>(bytecode_.length());
+    std::fill(visited.begin(), visited.end(), false);
+
+    // Follow all epsilon transitions from the start of the pattern.  Treating
+    // END_LOOP as always passing over-approximates the set of start
+    // characters, which is fine.
+    ZoneList<int> worklist(4, zone_);
+    worklist.Add(kPreambleLength, zone_);
+    while (!worklist.is_empty()) {
+      int pc = worklist.RemoveLast();
+      if (visited[pc]) continue;
+      visited[pc] = true;
+      RegExpInstruction inst = bytecode_[pc];
+      switch (inst.opcode) {
+        case RegExpInstruction::CONSUME_RANGE:
+          is_start_consume_pc_[pc] = true;
+          start_ranges_.Add(inst.payload.consume_range, zone_);
+          break;
+        case RegExpInstruction::FORK:
+          worklist.Add(inst.payload.pc, zone_);
+          worklist.Add(pc + 1, zone_);
+          break;
+        case RegExpInstruction::JMP:
+          worklist.Add(inst.payload.pc, zone_);
+          break;
+        case RegExpInstruction::SET_REGISTER_TO_CP:
+        case RegExpInstruction::CLEAR_REGISTER:
+        case RegExpInstruction::BEGIN_LOOP:
+        case RegExpInstruction::END_LOOP:
+          worklist.Add(pc + 1, zone_);
+          break;
+        case RegExpInstruction::ACCEPT:
+        case RegExpInstruction::ASSERTION:
+        case RegExpInstruction::WRITE_LOOKBEHIND_TABLE:
+        case RegExpInstruction::READ_LOOKBEHIND_TABLE:
+          start_ranges_.DropAndClear();
+          return;
+      }
+    }
+
+    std::fill(std::begin(one_byte_start_table_),
+              std::end(one_byte_start_table_), false);
+    int start_char_count = 0;
+    for (RegExpInstruction::Uc16Range range : start_ranges_) {
+      for (int c = range.min; c <= std::min<int>(range.max, kMaxUInt8); ++c) {
+        if (!one_byte_start_table_[c]) start_char_count++;
+        one_byte_start_table_[c] = true;
+      }
+    }
+    if (start_char_count == 1) {
+      single_one_byte_start_char_ = static_cast<int>(
+          std::find(std::begin(one_byte_start_table_),
+                    std::end(one_byte_start_table_), true) -
+          std::begin(one_byte_start_table_));
+    }
+    can_fast_forward_ = true;
+  }
+
+  bool IsStartCharacter(Character c) const {
+    if constexpr (sizeof(Character) == 1) {
+      return one_byte_start_table_[c];
+    } else {
+      if (c <= kMaxUInt8) return one_byte_start_table_[c];
+      for (RegExpInstruction::Uc16Range range : start_ranges_) {
+        if (c >= range.min && c <= range.max) return true;
+      }
+      return false;
+    }
+  }
+
+  // Whether the current blocked threads are those of a fresh match attempt,
+  // possibly plus threads of earlier attempts that will die on any character
+  // that can't start a match.  See `InitializeFastForward`.
+  bool CanFastForward() const {
+    if (!can_fast_forward_ || FoundMatch()) return false;
+    for (InterpreterThread t : blocked_threads_) {
+      if (t.pc != kPreambleConsumePc && !is_start_consume_pc_[t.pc]) {
+        return false;
+      }
+    }
+    return true;
+  }
+
+  // Advances `input_index_` to the next character that can start a match (or
+  // the end of the input) and restarts the match attempt there.
+  void FastForward() {
+    DCHECK(CanFastForward());
+    DCHECK(active_threads_.is_empty());
+    const Character* begin = input_.begin();
+    const Character* cursor = begin + input_index_;
+    const Character* end = input_.end();
+    if constexpr (sizeof(Character) == 1) {
+      if (single_one_byte_start_char_ >= 0) {
+        const void* found = memchr(cursor, single_one_byte_start_char_,
+                                   static_cast<size_t>(end - cursor));
+        cursor = found ? static_cast<const Character*>(found) : end;
+      }
+    }
+    while (cursor != end && !IsStartCharacter(*cursor)) ++cursor;
+
+    int next_index = static_cast<int>(cursor - begin);
+    if (next_index == input_index_) return;
+
+    for (InterpreterThread t : blocked_threads_) {
+      DestroyThread(t);
+    }
+    blocked_threads_.DropAndClear();
+
+    input_index_ = next_index;
+    active_threads_.Add(
+        InterpreterThread(0, NewRegisterArray(kUndefinedRegisterValue),
+                          InterpreterThread::ConsumedCharacter::DidConsume),
+        zone_);
+    RunActiveThreads();
+  }
+
   base::Vector<int> GetRegisterArray(InterpreterThread t) {
     return base::Vector<int>(t.register_array_begin, register_count_per_match_);
   }
@@ -688,6 +860,15 @@ class NfaInterpreter {
   // lookbehind of index k did complete a match on the current position.
   ZoneList<bool> lookbehind_table_;
 
+  // Characters that can start a match, and the pcs of the CONSUME_RANGE
+  // instructions they are consumed by, if `can_fast_forward_`.  Computed in
+  // `InitializeFastForward`.
+  bool can_fast_forward_ = false;
+  ZoneList<RegExpInstruction::Uc16Range> start_ranges_;
+  base::Vector<bool> is_start_consume_pc_;
+  bool one_byte_start_table_[kMaxUInt8 + 1];
+  int single_one_byte_start_char_ = -1;
+
   Zone* zone_;
 };
 
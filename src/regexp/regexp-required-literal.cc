@@ -0,0 +1,192 @@
+// Copyright 2024 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#include "src/regexp/regexp-required-literal.h"
+
+#include "src/regexp/regexp-ast.h"
+#include "src/zone/zone-containers.h"
+#include "src/zone/zone-list-inl.h"
+
+namespace v8 {
+namespace internal {
+
+namespace {
+
+class RequiredLiteralExtractor {
+ public:
+  struct Result {
+    explicit Result(Zone* zone) : exact(zone), required(zone) {}
+
+    // Whether every match of the node is exactly {exact}.
+    bool is_exact = false;
+    ZoneVector<base::uc16> exact;
+    // The longest known string that occurs in every match of the node.
+    ZoneVector<base::uc16> required;
+  };
+
+  explicit RequiredLiteralExtractor(Zone* zone) : zone_(zone) {}
+
+  Result Extract(RegExpTree* tree) {
+    Result result(zone_);
+    // Deeply nested patterns are rare, and are left alone.
+    if (depth_ >= kMaxDepth) return result;
+    depth_++;
+    if (tree->IsAtom()) {
+      base::Vector<const base::uc16> data = tree->AsAtom()->data();
+      SetExact(&result, data.begin(), data.end());
+    } else if (tree->IsClassRanges()) {
+      base::uc16 c;
+      if (IsSingleCharacter(tree->AsClassRanges(), &c, zone_)) {
+        SetExact(&result, &c, &c + 1);
+      }
+    } else if (tree->IsText()) {
+      ExtractFromText(tree->AsText(), &result);
+    } else if (tree->IsAlternative()) {
+      ExtractFromAlternative(tree->AsAlternative(), &result);
+    } else if (tree->IsQuantifier()) {
+      ExtractFromQuantifier(tree->AsQuantifier(), &result);
+    } else if (tree->IsCapture()) {
+      result = Extract(tree->AsCapture()->body());
+    } else if (tree->IsGroup()) {
+      if (!IsIgnoreCase(tree->AsGroup()->flags())) {
+        result = Extract(tree->AsGroup()->body());
+      }
+    } else if (tree->IsEmpty()) {
+      result.is_exact = true;
+    }
+    // Disjunctions, assertions, lookarounds, back references and class set
+    // expressions contribute nothing.
+    depth_--;
+    return result;
+  }
+
+ private:
+  static constexpr int kMaxDepth = 32;
+  static constexpr size_t kMaxLength = 256;
+
+  static void SetExact(Result* result, const base::uc16* begin,
+                       const base::uc16* end) {
+    result->is_exact = true;
+    result->exact.assign(begin, end);
+    result->required.assign(begin, end);
+  }
+
+  static bool IsSingleCharacter(RegExpClassRanges* node, base::uc16* c,
+                                Zone* zone) {
+    if (node->is_negated() || node->is_case_folded() ||
+        node->character_set().is_standard()) {
+      return false;
+    }
+    ZoneList<CharacterRange>* ranges = node->ranges(zone);
+    if (ranges->length() != 1) return false;
+    CharacterRange range = ranges->at(0);
+    if (range.from() != range.to() || range.from() > kMaxUInt16) return false;
+    *c = static_cast<base::uc16>(range.from());
+    return true;
+  }
+
+  // Keeps the longer of {result->required} and {candidate}.
+  static void Consider(Result* result,
+                       const ZoneVector<base::uc16>& candidate) {
+    if (candidate.size() > result->required.size()) {
+      result->required.assign(candidate.begin(), candidate.end());
+    }
+  }
+
+  // Concatenations: adjacent exact parts form a longer required literal.
+  template <typename F>
+  void ExtractFromSequence(int length, F&& part, Result* result) {
+    ZoneVector<base::uc16> run(zone_);
+    bool all_exact = true;
+    for (int i = 0; i < length; i++) {
+      Result part_result = part(i);
+      if (part_result.is_exact &&
+          run.size() + part_result.exact.size() <= kMaxLength) {
+        run.insert(run.end(), part_result.exact.begin(),
+                   part_result.exact.end());
+        continue;
+      }
+      all_exact = false;
+      Consider(result, run);
+      Consider(result, part_result.required);
+      run.clear();
+    }
+    Consider(result, run);
+    if (all_exact) {
+      result->is_exact = true;
+      result->exact.assign(run.begin(), run.end());
+    }
+  }
+
+  void ExtractFromText(RegExpText* node, Result* result) {
+    ZoneList<TextElement>* elements = node->elements();
+    ExtractFromSequence(
+        elements->length(),
+        [&](int i) {
+          TextElement element = elements->at(i);
+          return Extract(element.text_type() == TextElement::ATOM
+                             ? static_cast<RegExpTree*>(element.atom())
+                             : element.class_ranges());
+        },
+        result);
+  }
+
+  void ExtractFromAlternative(RegExpAlternative* node, Result* result) {
+    ZoneList<RegExpTree*>* nodes = node->nodes();
+    ExtractFromSequence(
+        nodes->length(), [&](int i) { return Extract(nodes->at(i)); },
+        result);
+  }
+
+  void ExtractFromQuantifier(RegExpQuantifier* node, Result* result) {
+    if (node->max() == 0) {
+      result->is_exact = true;
+      return;
+    }
+    // Only mandatory iterations are required to match.
+    if (node->min() == 0) return;
+    Result body = Extract(node->body());
+    if (body.is_exact && node->min() == node->max() &&
+        body.exact.size() * node->min() <= kMaxLength) {
+      result->is_exact = true;
+      for (int i = 0; i < node->min(); i++) {
+        result->exact.insert(result->exact.end(), body.exact.begin(),
+                             body.exact.end());
+      }
+      result->required.assign(result->exact.begin(), result->exact.end());
+    } else {
+      result->required.assign(body.required.begin(), body.required.end());
+    }
+  }
+
+  Zone* const zone_;
+  int depth_ = 0;
+};
+
+}  // namespace
+
+// static
+base::Vector<const uint8_t> RegExpRequiredLiteral::Extract(RegExpTree* tree,
+                                                           RegExpFlags flags,
+                                                           Zone* zone) {
+  if (IsIgnoreCase(flags)) return {};
+  // Sticky and start-anchored regexps are only tried at a single position, so
+  // a search through the rest of the subject would cost more than it saves.
+  if (IsSticky(flags) || tree->IsAnchoredAtStart()) return {};
+  RequiredLiteralExtractor extractor(zone);
+  RequiredLiteralExtractor::Result result = extractor.Extract(tree);
+  const ZoneVector<base::uc16>& literal = result.required;
+  if (literal.size() < static_cast<size_t>(kMinLength)) return {};
+
+  base::Vector<uint8_t> one_byte_literal =
+      zone->AllocateVector<uint8_t>(literal.size());
+  for (size_t i = 0; i < literal.size(); i++) {
+    if (literal[i] > kMaxUInt8) return {};
+    one_byte_literal[i] = static_cast<uint8_t>(literal[i]);
+  }
+  return one_byte_literal;
+}
+
+}  // namespace internal
+}  // namespace v8
@@ -0,0 +1,38 @@
+// Copyright 2024 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#ifndef V8_REGEXP_REGEXP_REQUIRED_LITERAL_H_
+#define V8_REGEXP_REGEXP_REQUIRED_LITERAL_H_
+
+#include "src/base/vector.h"
+#include "src/common/globals.h"
+#include "src/regexp/regexp-flags.h"
+
+namespace v8 {
+namespace internal {
+
+class RegExpTree;
+class Zone;
+
+// Finds a literal string that occurs in every match of a regexp, e.g.
+// "@example.com" in /\w+@example\.com/. If the subject doesn't contain it at
+// or after the start position, the match attempt can be skipped altogether,
+// which a single (vectorized) string search decides much faster than the
+// regexp engine trying every start position.
+class RegExpRequiredLiteral final : public AllStatic {
+ public:
+  // Literals shorter than this aren't worth an extra pass over the subject.
+  static constexpr int kMinLength = 2;
+
+  // Returns the longest required literal found in {tree}, or an empty vector.
+  // Only one-byte literals are returned, and none for case-insensitive,
+  // sticky or start-anchored regexps.
+  V8_EXPORT_PRIVATE static base::Vector<const uint8_t> Extract(
+      RegExpTree* tree, RegExpFlags flags, Zone* zone);
+};
+
+}  // namespace internal
+}  // namespace v8
+
+#endif  // V8_REGEXP_REGEXP_REQUIRED_LITERAL_H_
@@ -19,6 +19,7 @@
 #include "src/regexp/regexp-macro-assembler-arch.h"
 #include "src/regexp/regexp-macro-assembler-tracer.h"
 #include "src/regexp/regexp-parser.h"
+#include "src/regexp/regexp-required-literal.h"
 #include "src/regexp/regexp-utils.h"
 #include "src/strings/string-search.h"
 #include "src/utils/ostreams.h"
@@ -609,6 +610,19 @@ bool RegExpImpl::CompileIrregexp(Isolate* isolate, Handle<JSRegExp> re,
   }
   data->set(JSRegExp::kIrregexpBacktrackLimit, Smi::FromInt(backtrack_limit));
 
+  if (v8_flags.regexp_required_literal_prefilter) {
+    base::Vector<const uint8_t> required_literal =
+        RegExpRequiredLiteral::Extract(compile_data.tree, flags, &zone);
+    if (!required_literal.empty()) {
+      Handle<String> literal = isolate->factory()
+                                   ->NewStringFromOneByte(required_literal,
+                                                          AllocationType::kOld)
+                                   .ToHandleChecked();
+      DCHECK(IsSeqOneByteString(*literal));
+      data->set(JSRegExp::kIrregexpRequiredLiteralIndex, *literal);
+    }
+  }
+
   if (v8_flags.trace_regexp_tier_up) {
     PrintF("JSRegExp object %p %s size: %d\n",
            reinterpret_cast<void*>(re->ptr()),
@@ -681,6 +695,18 @@ int RegExpImpl::IrregexpExecRaw(Isolate* isolate, Handle<JSRegExp> regexp,
   DCHECK_GE(output_size,
             JSRegExp::RegistersForCaptureCount(regexp->capture_count()));
 
+  // Every match contains the required literal, so without one at or after
+  // {index} there is nothing to do. RegExpExecInternal does the same check.
+  Tagged<Object> required_literal =
+      FixedArray::cast(regexp->data())
+          ->get(JSRegExp::kIrregexpRequiredLiteralIndex);
+  if (IsString(required_literal) &&
+      String::IndexOf(isolate, subject,
+                      handle(String::cast(required_literal), isolate),
+                      index) == -1) {
+    return RegExp::RE_FAILURE;
+  }
+
   bool is_one_byte = String::IsOneByteRepresentationUnderneath(*subject);
 
   if (!regexp->ShouldProduceBytecode()) {
@@ -0,0 +1,49 @@
+// Copyright 2024 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#include "src/strings/mapped-file-string-resource.h"
+
+#include <unordered_set>
+
+#include "src/base/lazy-instance.h"
+#include "src/base/platform/mutex.h"
+
+namespace v8 {
+namespace internal {
+
+namespace {
+
+using ResourceSet = std::unordered_set<MappedFileStringResource*>;
+
+// Resources are created and disposed by any isolate, so the set of all of them
+// is guarded by a mutex.
+DEFINE_LAZY_LEAKY_OBJECT_GETTER(ResourceSet, GetAllResources)
+base::LazyMutex all_resources_mutex = LAZY_MUTEX_INITIALIZER;
+
+}  // namespace
+
+MappedFileStringResource::MappedFileStringResource(
+    std::unique_ptr<base::OS::MemoryMappedFile> file)
+    : file_(std::move(file)) {
+  base::MutexGuard guard(all_resources_mutex.Pointer());
+  GetAllResources()->insert(this);
+}
+
+MappedFileStringResource::~MappedFileStringResource() {
+  base::MutexGuard guard(all_resources_mutex.Pointer());
+  GetAllResources()->erase(this);
+}
+
+// static
+void MappedFileStringResource::DiscardAllResidentPages() {
+  // Dropping pages is safe while other threads read the strings; they just
+  // fault the pages back in.
+  base::MutexGuard guard(all_resources_mutex.Pointer());
+  for (MappedFileStringResource* resource : *GetAllResources()) {
+    resource->file_->DiscardResidentPages();
+  }
+}
+
+}  // namespace internal
+}  // namespace v8
@@ -0,0 +1,54 @@
+// Copyright 2024 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#ifndef V8_STRINGS_MAPPED_FILE_STRING_RESOURCE_H_
+#define V8_STRINGS_MAPPED_FILE_STRING_RESOURCE_H_
+
+#include <memory>
+
+#include "include/v8-primitive.h"
+#include "src/base/platform/platform.h"
+#include "src/common/globals.h"
+
+namespace v8 {
+namespace internal {
+
+// The characters of an external one-byte string that are the contents of a
+// file mapped into memory, rather than read into a buffer. The pages of the
+// file are only read when they are accessed, and since they are never
+// written to, they can be dropped at any time and are read back from the file
+// on their next access. This keeps large script sources that are rarely
+// looked at after compilation, e.g. only for Function.prototype.toString or
+// lazy compilation, out of the resident memory of the process.
+//
+// All such resources in the process are registered, so that they can be
+// dropped under memory pressure.
+class V8_EXPORT_PRIVATE MappedFileStringResource final
+    : public v8::String::ExternalOneByteStringResource {
+ public:
+  // The file has to be mapped read-only and its contents have to be ASCII.
+  explicit MappedFileStringResource(
+      std::unique_ptr<base::OS::MemoryMappedFile> file);
+  ~MappedFileStringResource() override;
+
+  MappedFileStringResource(const MappedFileStringResource&) = delete;
+  MappedFileStringResource& operator=(const MappedFileStringResource&) =
+      delete;
+
+  const char* data() const override {
+    return static_cast<const char*>(file_->memory());
+  }
+  size_t length() const override { return file_->size(); }
+
+  // Drops the resident pages of all mapped files in the process.
+  static void DiscardAllResidentPages();
+
+ private:
+  std::unique_ptr<base::OS::MemoryMappedFile> file_;
+};
+
+}  // namespace internal
+}  // namespace v8
+
+#endif  // V8_STRINGS_MAPPED_FILE_STRING_RESOURCE_H_
@@ -5,10 +5,12 @@
 #ifndef V8_STRINGS_STRING_SEARCH_H_
 #define V8_STRINGS_STRING_SEARCH_H_
 
+#include "src/base/bits.h"
 #include "src/base/strings.h"
 #include "src/base/vector.h"
 #include "src/execution/isolate.h"
 #include "src/objects/string.h"
+#include "src/strings/string-simd.h"
 
 namespace v8 {
 namespace internal {
@@ -264,6 +266,138 @@ inline bool CharCompare(const PatternChar* pattern, const SubjectChar* subject,
   return true;
 }
 
+#if defined(__SSE3__) || defined(NEON64)
+// Vectorized search for patterns of at least two characters: for a block of
+// start positions, compare the subject with the first and the last pattern
+// character at once, and only compare the remaining pattern characters at
+// positions where both match. This filters out almost all positions even for
+// short patterns whose first character is common.
+
+// Returns the first lane in {mask} (see string-simd.h) at which the whole
+// pattern matches the subject starting at {block}, or -1 if there is none.
+template <typename PatternChar, typename SubjectChar>
+inline int FirstFullMatchInBlock(base::Vector<const PatternChar> pattern,
+                                 const SubjectChar* block, uint64_t mask) {
+  const int pattern_length = pattern.length();
+  while (mask != 0) {
+    int lane = FirstSetLane<SubjectChar>(mask);
+    if (pattern_length == 2 || CharCompare(pattern.begin() + 1,
+                                           block + lane + 1,
+                                           pattern_length - 2)) {
+      return lane;
+    }
+    mask = ClearFirstSetLane<SubjectChar>(mask);
+  }
+  return -1;
+}
+
+#ifdef V8_STRING_SIMD_AVX2
+// As FindFirstAndLastCharacterSimd below, with blocks of 32 bytes.
+template <typename PatternChar, typename SubjectChar>
+V8_TARGET_AVX2 inline int FindFirstAndLastCharacterAvx2(
+    base::Vector<const PatternChar> pattern,
+    base::Vector<const SubjectChar> subject, int* index) {
+  const int pattern_length = pattern.length();
+  const SubjectChar first_char = static_cast<SubjectChar>(pattern[0]);
+  const SubjectChar last_char =
+      static_cast<SubjectChar>(pattern[pattern_length - 1]);
+  const __m256i first =
+      sizeof(SubjectChar) == 1
+          ? _mm256_set1_epi8(static_cast<char>(first_char))
+          : _mm256_set1_epi16(static_cast<int16_t>(first_char));
+  const __m256i last =
+      sizeof(SubjectChar) == 1
+          ? _mm256_set1_epi8(static_cast<char>(last_char))
+          : _mm256_set1_epi16(static_cast<int16_t>(last_char));
+  constexpr int kLanes = sizeof(__m256i) / sizeof(SubjectChar);
+  const int max_start = subject.length() - pattern_length;
+  int i = *index;
+  for (; i + kLanes - 1 <= max_start; i += kLanes) {
+    const SubjectChar* block = subject.begin() + i;
+    __m256i first_block =
+        _mm256_loadu_si256(reinterpret_cast<const __m256i*>(block));
+    __m256i last_block = _mm256_loadu_si256(
+        reinterpret_cast<const __m256i*>(block + pattern_length - 1));
+    __m256i matches =
+        sizeof(SubjectChar) == 1
+            ? _mm256_and_si256(_mm256_cmpeq_epi8(first_block, first),
+                               _mm256_cmpeq_epi8(last_block, last))
+            : _mm256_and_si256(_mm256_cmpeq_epi16(first_block, first),
+                               _mm256_cmpeq_epi16(last_block, last));
+    int lane = FirstFullMatchInBlock(pattern, block, SimdMask(matches));
+    if (lane != -1) return i + lane;
+  }
+  *index = i;
+  return -1;
+}
+#endif  // V8_STRING_SIMD_AVX2
+
+// Returns the position of the first match at or after {*index} among the
+// start positions covered by full blocks, or -1 if there is none. In the
+// latter case, {*index} is updated to the first position that has not been
+// checked yet.
+template <typename PatternChar, typename SubjectChar>
+inline int FindFirstAndLastCharacterSimd(
+    base::Vector<const PatternChar> pattern,
+    base::Vector<const SubjectChar> subject, int* index) {
+  static_assert(sizeof(SubjectChar) == 1 || sizeof(SubjectChar) == 2);
+  const int pattern_length = pattern.length();
+  DCHECK_GT(pattern_length, 1);
+#ifdef V8_STRING_SIMD_AVX2
+  if (CpuFeatures::IsSupported(AVX2)) {
+    int result = FindFirstAndLastCharacterAvx2(pattern, subject, index);
+    if (result != -1) return result;
+  }
+#endif
+  // Pattern characters fit into SubjectChar; otherwise the search would have
+  // been set up as FailSearch.
+  const SubjectChar first_char = static_cast<SubjectChar>(pattern[0]);
+  const SubjectChar last_char =
+      static_cast<SubjectChar>(pattern[pattern_length - 1]);
+  constexpr int kLanes = 16 / sizeof(SubjectChar);
+  const int max_start = subject.length() - pattern_length;
+  int i = *index;
+#ifdef __SSE3__
+  const __m128i first = sizeof(SubjectChar) == 1
+                            ? _mm_set1_epi8(static_cast<char>(first_char))
+                            : _mm_set1_epi16(static_cast<int16_t>(first_char));
+  const __m128i last = sizeof(SubjectChar) == 1
+                           ? _mm_set1_epi8(static_cast<char>(last_char))
+                           : _mm_set1_epi16(static_cast<int16_t>(last_char));
+#endif
+  for (; i + kLanes - 1 <= max_start; i += kLanes) {
+    const SubjectChar* block = subject.begin() + i;
+    const SubjectChar* block_end = block + pattern_length - 1;
+    uint64_t mask;
+#ifdef __SSE3__
+    __m128i first_block =
+        _mm_loadu_si128(reinterpret_cast<const __m128i*>(block));
+    __m128i last_block =
+        _mm_loadu_si128(reinterpret_cast<const __m128i*>(block_end));
+    mask = SimdMask(sizeof(SubjectChar) == 1
+                        ? _mm_and_si128(_mm_cmpeq_epi8(first_block, first),
+                                        _mm_cmpeq_epi8(last_block, last))
+                        : _mm_and_si128(_mm_cmpeq_epi16(first_block, first),
+                                        _mm_cmpeq_epi16(last_block, last)));
+#else
+    if constexpr (sizeof(SubjectChar) == 1) {
+      mask = SimdMask(
+          vandq_u8(vceqq_u8(SimdLoad(block), vdupq_n_u8(first_char)),
+                   vceqq_u8(SimdLoad(block_end), vdupq_n_u8(last_char))));
+    } else {
+      mask = SimdMask(
+          vandq_u16(vceqq_u16(SimdLoad(block), vdupq_n_u16(first_char)),
+                    vceqq_u16(SimdLoad(block_end), vdupq_n_u16(last_char))));
+    }
+#endif
+    int lane = FirstFullMatchInBlock(pattern, block, mask);
+    if (lane != -1) return i + lane;
+  }
+  *index = i;
+  return -1;
+}
+#endif  // __SSE3__ || NEON64
+
 // Simple linear search for short patterns. Never bails out.
 template <typename PatternChar, typename SubjectChar>
 int StringSearch<PatternChar, SubjectChar>::LinearSearch(
@@ -274,6 +408,10 @@ int StringSearch<PatternChar, SubjectChar>::LinearSearch(
   int pattern_length = pattern.length();
   int i = index;
   int n = subject.length() - pattern_length;
+#if defined(__SSE3__) || defined(NEON64)
+  int result = FindFirstAndLastCharacterSimd(pattern, subject, &i);
+  if (result != -1) return result;
+#endif
   while (i <= n) {
     i = FindFirstCharacter(pattern, subject, i);
     if (i == -1) return -1;
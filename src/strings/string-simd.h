@@ -0,0 +1,171 @@
+// Copyright 2024 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#ifndef V8_STRINGS_STRING_SIMD_H_
+#define V8_STRINGS_STRING_SIMD_H_
+
+#include <cstdint>
+
+#include "src/base/bits.h"
+#include "src/base/build_config.h"
+#include "src/base/logging.h"
+#include "src/codegen/cpu-features.h"
+
+// Shared building blocks for scanning one-byte and two-byte characters 16
+// bytes at a time with SSE or Neon, or 32 bytes at a time with AVX2 where the
+// CPU supports it. The guards follow src/objects/simd.cc.
+
+#ifdef _MSC_VER
+// MSVC doesn't define SSE3. However, it does define AVX, and AVX implies SSE3.
+#ifdef __AVX__
+#ifndef __SSE3__
+#define __SSE3__
+#endif
+#endif
+#endif
+
+#ifdef __SSE3__
+#include <immintrin.h>
+#endif
+
+#ifdef V8_HOST_ARCH_ARM64
+// We use Neon only on 64-bit ARM (because on 32-bit, some instructions and some
+// types are not available). Note that ARM64 is guaranteed to have Neon.
+#ifndef NEON64
+#define NEON64
+#endif
+#include <arm_neon.h>
+#endif
+
+// Since we don't compile with -mavx2 (or /arch:AVX2 on MSVC), AVX2 code is
+// only generated for functions marked with V8_TARGET_AVX2, which must only be
+// called after checking CpuFeatures::IsSupported(AVX2).
+#if defined(__SSE3__) && !defined(_M_IX86) &&                     \
+    !(defined(_MSC_VER) && defined(__clang__)) &&                 \
+    (defined(V8_TARGET_ARCH_IA32) || defined(V8_TARGET_ARCH_X64))
+#define V8_STRING_SIMD_AVX2 1
+#ifdef _MSC_VER
+#define V8_TARGET_AVX2
+#else
+#define V8_TARGET_AVX2 __attribute__((target("avx2")))
+#endif
+#endif
+
+namespace v8 {
+namespace internal {
+
+#if defined(__SSE3__) || defined(NEON64)
+
+// A comparison yields a vector in which every lane is either all ones or all
+// zeros. SimdMask turns such a vector into an integer with
+// {kSimdMaskBitsPerByte} bits for every byte of the vector, so that the first
+// set lane can be found by counting trailing zeros.
+#ifdef __SSE3__
+constexpr int kSimdMaskBitsPerByte = 1;
+
+inline uint64_t SimdMask(__m128i lanes) {
+  return static_cast<uint32_t>(_mm_movemask_epi8(lanes));
+}
+
+#ifdef V8_STRING_SIMD_AVX2
+V8_TARGET_AVX2 inline uint64_t SimdMask(__m256i lanes) {
+  return static_cast<uint32_t>(_mm256_movemask_epi8(lanes));
+}
+#endif  // V8_STRING_SIMD_AVX2
+
+#else
+constexpr int kSimdMaskBitsPerByte = 4;
+
+// Neon has no movemask. Shifting the 16-bit lanes right by 4 and narrowing
+// them to 8 bits keeps one nibble of every byte.
+inline uint64_t SimdMask(uint8x16_t lanes) {
+  return vget_lane_u64(
+      vreinterpret_u64_u8(vshrn_n_u16(vreinterpretq_u16_u8(lanes), 4)), 0);
+}
+
+inline uint64_t SimdMask(uint16x8_t lanes) {
+  return SimdMask(vreinterpretq_u8_u16(lanes));
+}
+
+inline uint8x16_t SimdLoad(const uint8_t* chars) { return vld1q_u8(chars); }
+inline uint16x8_t SimdLoad(const uint16_t* chars) { return vld1q_u16(chars); }
+#endif  // __SSE3__
+
+// Returns the index of the first set {Char} lane in {mask}, which must not be
+// zero.
+template <typename Char>
+inline int FirstSetLane(uint64_t mask) {
+  DCHECK_NE(mask, 0);
+  return static_cast<int>(base::bits::CountTrailingZeros(mask) /
+                          (kSimdMaskBitsPerByte * sizeof(Char)));
+}
+
+// Returns {mask} without its first set {Char} lane.
+template <typename Char>
+inline uint64_t ClearFirstSetLane(uint64_t mask) {
+  constexpr int kBitsPerLane =
+      kSimdMaskBitsPerByte * static_cast<int>(sizeof(Char));
+  uint64_t lane_bits = (uint64_t{1} << kBitsPerLane) - 1;
+  return mask & ~(lane_bits << (FirstSetLane<Char>(mask) * kBitsPerLane));
+}
+
+#ifdef V8_STRING_SIMD_AVX2
+template <typename Char, typename Matcher>
+V8_TARGET_AVX2 inline const Char* FindFirstMatchingCharacterAvx2(
+    const Char* cursor, const Char* end, const Matcher& matcher) {
+  constexpr int kLanes = sizeof(__m256i) / sizeof(Char);
+  for (; end - cursor >= kLanes; cursor += kLanes) {
+    uint64_t mask = SimdMask(
+        matcher(_mm256_loadu_si256(reinterpret_cast<const __m256i*>(cursor))));
+    if (mask != 0) return cursor + FirstSetLane<Char>(mask);
+  }
+  return cursor;
+}
+#endif  // V8_STRING_SIMD_AVX2
+
+#endif  // __SSE3__ || NEON64
+
+// Returns the first character in [start, end) for which {matcher} returns
+// true, or {end} if there is none. Besides single characters, {matcher} is
+// called with vectors of characters where SIMD is available (__m128i, and
+// __m256i in a V8_TARGET_AVX2 overload, with SSE; uint8x16_t or uint16x8_t
+// with Neon). It then has to return a vector in which the lanes of matching
+// characters are all ones and the other lanes are all zeros.
+template <typename Char, typename Matcher>
+inline const Char* FindFirstMatchingCharacter(const Char* start,
+                                              const Char* end,
+                                              const Matcher& matcher) {
+  static_assert(sizeof(Char) == 1 || sizeof(Char) == 2);
+  const Char* cursor = start;
+#ifdef __SSE3__
+#ifdef V8_STRING_SIMD_AVX2
+  if (CpuFeatures::IsSupported(AVX2)) {
+    // Stops at the first match, which the loop below then finds again, or
+    // where fewer than 32 bytes are left.
+    cursor = FindFirstMatchingCharacterAvx2(cursor, end, matcher);
+  }
+#endif
+  constexpr int kLanes = sizeof(__m128i) / sizeof(Char);
+  for (; end - cursor >= kLanes; cursor += kLanes) {
+    uint64_t mask = SimdMask(
+        matcher(_mm_loadu_si128(reinterpret_cast<const __m128i*>(cursor))));
+    if (mask != 0) return cursor + FirstSetLane<Char>(mask);
+  }
+#elif defined(NEON64)
+  constexpr int kLanes = 16 / sizeof(Char);
+  for (; end - cursor >= kLanes; cursor += kLanes) {
+    uint64_t mask = SimdMask(matcher(SimdLoad(cursor)));
+    if (mask != 0) return cursor + FirstSetLane<Char>(mask);
+  }
+#endif
+  for (; cursor < end; ++cursor) {
+    if (matcher(*cursor)) break;
+  }
+  return cursor;
+}
+
+}  // namespace internal
+}  // namespace v8
+
+#endif  // V8_STRINGS_STRING_SIMD_H_
@@ -5,6 +5,7 @@
 #include "src/strings/unicode-decoder.h"
 
 #include "src/strings/unicode-inl.h"
+#include "src/strings/unicode-simd.h"
 #include "src/utils/memcopy.h"
 
 #if V8_ENABLE_WEBASSEMBLY
@@ -76,9 +77,11 @@ Utf8DecoderBase<Decoder>::Utf8DecoderBase(base::Vector<const uint8_t> data)
                   state == Traits::DfaDecoder::kAccept)) {
       DCHECK_EQ(0u, current);
       DCHECK(!Traits::IsInvalidSurrogatePair(previous, *cursor));
-      previous = *cursor;
-      utf16_length_++;
-      cursor++;
+      // Skip the whole ASCII run; mostly-ASCII text is the common case.
+      const uint8_t* run_end = FindNonAsciiCharacter(cursor, end);
+      previous = run_end[-1];
+      utf16_length_ += static_cast<int>(run_end - cursor);
+      cursor = run_end;
       continue;
     }
 
@@ -144,8 +147,10 @@ void Utf8DecoderBase<Decoder>::Decode(Char* out,
     if (V8_LIKELY(*cursor <= unibrow::Utf8::kMaxOneByteChar &&
                   state == Traits::DfaDecoder::kAccept)) {
       DCHECK_EQ(0u, current);
-      *(out++) = static_cast<Char>(*cursor);
-      cursor++;
+      const uint8_t* run_end = FindNonAsciiCharacter(cursor, end);
+      CopyChars(out, cursor, run_end - cursor);
+      out += run_end - cursor;
+      cursor = run_end;
       continue;
     }
 
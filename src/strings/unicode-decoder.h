@@ -6,6 +6,7 @@
 #define V8_STRINGS_UNICODE_DECODER_H_
 
 #include "src/base/vector.h"
+#include "src/strings/unicode-simd.h"
 #include "src/strings/unicode.h"
 
 namespace v8 {
@@ -16,6 +17,11 @@ namespace internal {
 // If the return value is >= the passed length, the entire string was
 // one-byte.
 inline int NonAsciiStart(const uint8_t* chars, int length) {
+#if defined(V8_HOST_ARCH_X64) || defined(V8_HOST_ARCH_ARM64)
+  // With SIMD the result is exact.
+  return static_cast<int>(FindNonAsciiCharacter(chars, chars + length) -
+                          chars);
+#else
   const uint8_t* start = chars;
   const uint8_t* limit = chars + length;
 
@@ -46,6 +52,7 @@ inline int NonAsciiStart(const uint8_t* chars, int length) {
   }
 
   return static_cast<int>(chars - start);
+#endif
 }
 
 template <class Decoder>
@@ -0,0 +1,83 @@
+// Copyright 2024 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#ifndef V8_STRINGS_UNICODE_SIMD_H_
+#define V8_STRINGS_UNICODE_SIMD_H_
+
+#include <cstdint>
+
+#include "src/strings/string-simd.h"
+
+namespace v8 {
+namespace internal {
+
+template <typename Char>
+struct NonAsciiCharacterMatcher;
+
+template <>
+struct NonAsciiCharacterMatcher<uint8_t> {
+  bool operator()(uint8_t c) const { return c >= 0x80; }
+#ifdef __SSE3__
+  __m128i operator()(__m128i chars) const {
+    return _mm_cmplt_epi8(chars, _mm_setzero_si128());
+  }
+#endif
+#ifdef V8_STRING_SIMD_AVX2
+  V8_TARGET_AVX2 __m256i operator()(__m256i chars) const {
+    return _mm256_cmpgt_epi8(_mm256_setzero_si256(), chars);
+  }
+#endif
+#ifdef NEON64
+  uint8x16_t operator()(uint8x16_t chars) const {
+    return vcgeq_u8(chars, vdupq_n_u8(0x80));
+  }
+#endif
+};
+
+template <>
+struct NonAsciiCharacterMatcher<uint16_t> {
+  bool operator()(uint16_t c) const { return c >= 0x80; }
+#ifdef __SSE3__
+  __m128i operator()(__m128i chars) const {
+    __m128i ascii = _mm_cmpeq_epi16(
+        _mm_and_si128(chars, _mm_set1_epi16(static_cast<int16_t>(0xFF80))),
+        _mm_setzero_si128());
+    return _mm_xor_si128(ascii, _mm_set1_epi16(-1));
+  }
+#endif
+#ifdef V8_STRING_SIMD_AVX2
+  V8_TARGET_AVX2 __m256i operator()(__m256i chars) const {
+    __m256i ascii = _mm256_cmpeq_epi16(
+        _mm256_and_si256(chars,
+                         _mm256_set1_epi16(static_cast<int16_t>(0xFF80))),
+        _mm256_setzero_si256());
+    return _mm256_xor_si256(ascii, _mm256_set1_epi16(-1));
+  }
+#endif
+#ifdef NEON64
+  uint16x8_t operator()(uint16x8_t chars) const {
+    return vtstq_u16(chars, vdupq_n_u16(0xFF80));
+  }
+#endif
+};
+
+// Returns the first character in [start, end) that is not ASCII, or {end} if
+// there is none. This is the hot loop of both UTF-8 decoding and encoding,
+// since real-world text is mostly made of long ASCII runs.
+inline const uint8_t* FindNonAsciiCharacter(const uint8_t* start,
+                                            const uint8_t* end) {
+  return FindFirstMatchingCharacter(start, end,
+                                    NonAsciiCharacterMatcher<uint8_t>());
+}
+
+inline const uint16_t* FindNonAsciiCharacter(const uint16_t* start,
+                                             const uint16_t* end) {
+  return FindFirstMatchingCharacter(start, end,
+                                    NonAsciiCharacterMatcher<uint16_t>());
+}
+
+}  // namespace internal
+}  // namespace v8
+
+#endif  // V8_STRINGS_UNICODE_SIMD_H_
@@ -4421,7 +4421,8 @@ WasmCode* CompileImportWrapper(
   // yet.
   WasmImportWrapperCache::CacheKey key(kind, canonical_type_index,
                                        expected_arity, suspend);
-  DCHECK_NULL((*cache_scope)[key]);
+  WasmCode*& cache_slot = cache_scope->ExistingEntry(key);
+  DCHECK_NULL(cache_slot);
   bool source_positions = is_asmjs_module(native_module->module());
   // Keep the {WasmCode} alive until we explicitly call {IncRef}.
   WasmCodeRefScope code_ref_scope;
@@ -4436,7 +4437,7 @@ WasmCode* CompileImportWrapper(
       result.source_positions.as_vector(), GetCodeKind(result),
       ExecutionTier::kNone, kNotForDebugging);
   WasmCode* published_code = native_module->PublishCode(std::move(wasm_code));
-  (*cache_scope)[key] = published_code;
+  cache_slot = published_code;
   published_code->IncRef();
   counters->wasm_generated_code_size()->Increment(
       published_code->instructions().length());
@@ -835,10 +835,12 @@ class ModuleDecoderImpl : public Decoder {
           // ===== Imported global =============================================
           import->index = static_cast<uint32_t>(module_->globals.size());
           module_->num_imported_globals++;
-          module_->globals.push_back({kWasmVoid, false, {}, {0}, true, false});
+          module_->globals.push_back(
+              {kWasmVoid, false, false, {}, {0}, true, false});
           WasmGlobal* global = &module_->globals.back();
           global->type = consume_value_type();
-          global->mutability = consume_mutability();
+          consume_global_flags(global->type, &global->mutability,
+                               &global->shared);
           if (global->mutability) {
             module_->num_imported_mutable_globals++;
           }
@@ -1005,10 +1007,13 @@ class ModuleDecoderImpl : public Decoder {
       TRACE("DecodeGlobal[%d] module+%d\n", i, static_cast<int>(pc_ - start_));
       if (tracer_) tracer_->GlobalOffset(pc_offset());
       ValueType type = consume_value_type();
-      bool mutability = consume_mutability();
+      bool mutability;
+      bool shared;
+      consume_global_flags(type, &mutability, &shared);
       if (failed()) break;
       ConstantExpression init = consume_init_expr(module_.get(), type);
-      module_->globals.push_back({type, mutability, init, {0}, false, false});
+      module_->globals.push_back(
+          {type, mutability, shared, init, {0}, false, false});
     }
   }
 
@@ -2147,6 +2152,32 @@ class ModuleDecoderImpl : public Decoder {
     return val != 0;
   }
 
+  // Read the flags byte of a global: bit 0 is the mutability, bit 1 marks the
+  // global as shared (shared-everything threads proposal). The shared bit is
+  // only accepted with --experimental-wasm-shared, and is only validated:
+  // instances, and with them their globals, are not shared between threads.
+  void consume_global_flags(ValueType type, bool* mutability_out,
+                            bool* shared_out) {
+    if (tracer_) tracer_->Bytes(pc_, 1);
+    uint8_t flags = consume_u8("global flags");
+    uint8_t valid_flags = enabled_features_.has_shared() ? 0x3 : 0x1;
+    if (flags & ~valid_flags) {
+      errorf(pc_ - 1, "invalid global flags 0x%x", flags);
+    }
+    *mutability_out = flags & 0x1;
+    *shared_out = flags & 0x2;
+    if (tracer_) {
+      if (*shared_out) tracer_->Description(" shared");
+      tracer_->Description(*mutability_out ? " mutable" : " immutable");
+    }
+    // Until shared heap types are supported, only numeric globals can be
+    // shared.
+    if (V8_UNLIKELY(*shared_out && !type.is_numeric())) {
+      errorf(pc_ - 1, "shared global of non-shared type %s",
+             type.name().c_str());
+    }
+  }
+
   ValueType consume_value_type() {
     auto [result, length] =
         value_type_reader::read_value_type<FullValidationTag>(
@@ -1624,20 +1624,19 @@ Handle<JSFunction> CreateFunctionForCompileTimeImport(Isolate* isolate,
 }
 
 void InstanceBuilder::SanitizeImports() {
-  base::Vector<const uint8_t> wire_bytes =
-      module_object_->native_module()->wire_bytes();
+  Handle<FixedArray> import_names =
+      WasmModuleObject::GetOrCreateImportNames(isolate_, module_object_);
   const WellKnownImportsList& well_known_imports =
       module_->type_feedback.well_known_imports;
   for (size_t index = 0; index < module_->import_table.size(); ++index) {
     const WasmImport& import = module_->import_table[index];
 
-    Handle<String> module_name =
-        WasmModuleObject::ExtractUtf8StringFromModuleBytes(
-            isolate_, wire_bytes, import.module_name, kInternalize);
-
-    Handle<String> import_name =
-        WasmModuleObject::ExtractUtf8StringFromModuleBytes(
-            isolate_, wire_bytes, import.field_name, kInternalize);
+    Handle<String> module_name(
+        String::cast(import_names->get(static_cast<int>(2 * index))),
+        isolate_);
+    Handle<String> import_name(
+        String::cast(import_names->get(static_cast<int>(2 * index + 1))),
+        isolate_);
 
     if (import.kind == kExternalFunction) {
       WellKnownImport wki = well_known_imports.get(import.index);
@@ -2049,6 +2048,17 @@ bool InstanceBuilder::ProcessImportedGlobal(
     return false;
   }
 
+  // A mutable shared global would have to be backed by a WebAssembly.Global
+  // object that lives in the shared heap, which the JS API cannot create.
+  // Only the value of immutable shared globals can be imported.
+  if (global.shared && global.mutability) {
+    thrower_->LinkError(
+        "%s: mutable shared globals cannot be imported, because "
+        "WebAssembly.Global objects cannot be shared between threads",
+        ImportName(import_index, module_name, import_name).c_str());
+    return false;
+  }
+
   if (is_asmjs_module(module_)) {
     // Accepting {JSFunction} on top of just primitive values here is a
     // workaround to support legacy asm.js code with broken binding. Note
@@ -2142,7 +2152,9 @@ void InstanceBuilder::CompileImportWrappers(
   // 1) Insert nullptr entries in the cache for wrappers that need to be
   // compiled. 2) Compile wrappers in background tasks using the
   // ImportWrapperQueue. This way the cache won't invalidate other iterators
-  // when inserting a new WasmCode, since the key will already be there.
+  // when inserting a new WasmCode, since the key will already be there. Step
+  // 1 also records the keys that {cache_scope} publishes when it ends, so the
+  // background tasks only write to existing entries.
   ImportWrapperQueue import_wrapper_queue;
   for (int index = 0; index < num_imports; ++index) {
     Handle<Object> value = sanitized_imports_[index].value;
@@ -2375,13 +2387,46 @@ T* InstanceBuilder::GetRawUntaggedGlobalPtr(const WasmGlobal& global) {
 }
 
 // Process initialization of globals.
+namespace {
+// Whether {global} has the same initial value in every instance of {module}.
+// Reference values are objects of their instance, and only extended constant
+// expressions can read other globals, which in turn can only depend on
+// imports if there are imported globals.
+bool HasImportIndependentNumericValue(const WasmModule* module,
+                                      const WasmGlobal& global) {
+  if (global.imported || global.type.is_reference()) return false;
+  return global.init.kind() != ConstantExpression::kWireBytesRef ||
+         module->num_imported_globals == 0;
+}
+}  // namespace
+
 void InstanceBuilder::InitGlobals(
     Handle<WasmTrustedInstanceData> trusted_instance_data) {
+  // The first instance of a module object evaluates all initializers and
+  // keeps the import-independent numeric values as a template. Later
+  // instances copy these values instead of evaluating their initializers
+  // again, and only evaluate the others.
+  Tagged<Object> maybe_template = module_object_->untagged_globals_template();
+  Handle<ByteArray> globals_template;
+  if (IsByteArray(maybe_template)) {
+    globals_template = handle(ByteArray::cast(maybe_template), isolate_);
+  }
+  bool has_import_independent_values = false;
   for (const WasmGlobal& global : module_->globals) {
     if (global.mutability && global.imported) continue;
     // Happens with imported globals.
     if (!global.init.is_set()) continue;
 
+    if (HasImportIndependentNumericValue(module_, global)) {
+      has_import_independent_values = true;
+      if (!globals_template.is_null()) {
+        std::memcpy(GetRawUntaggedGlobalPtr<uint8_t>(global),
+                    globals_template->begin() + global.offset,
+                    global.type.value_kind_size());
+        continue;
+      }
+    }
+
     ValueOrError result =
         EvaluateConstantExpression(&init_expr_zone_, global.init, global.type,
                                    isolate_, trusted_instance_data);
@@ -2393,6 +2438,23 @@ void InstanceBuilder::InitGlobals(
       to_value(result).CopyTo(GetRawUntaggedGlobalPtr<uint8_t>(global));
     }
   }
+
+  if (!globals_template.is_null() || !has_import_independent_values) return;
+  globals_template = isolate_->factory()->NewByteArray(
+      static_cast<int>(module_->untagged_globals_buffer_size),
+      AllocationType::kOld);
+  // The slots of other globals are never read from the template.
+  std::memset(globals_template->begin(), 0, globals_template->length());
+  for (const WasmGlobal& global : module_->globals) {
+    if (!global.init.is_set() ||
+        !HasImportIndependentNumericValue(module_, global)) {
+      continue;
+    }
+    std::memcpy(globals_template->begin() + global.offset,
+                GetRawUntaggedGlobalPtr<uint8_t>(global),
+                global.type.value_kind_size());
+  }
+  module_object_->set_untagged_globals_template(*globals_template);
 }
 
 // Allocate memory for a module instance as a new JSArrayBuffer.
@@ -2478,9 +2540,14 @@ void InstanceBuilder::ProcessExports(
                                 PropertyConstness::kMutable};
 
   // Process each export in the export table.
-  for (const WasmExport& exp : module_->export_table) {
-    Handle<String> name = WasmModuleObject::ExtractUtf8StringFromModuleBytes(
-        isolate_, module_object_, exp.name, kInternalize);
+  Handle<FixedArray> export_names =
+      WasmModuleObject::GetOrCreateExportNames(isolate_, module_object_);
+  for (int export_index = 0,
+           end = static_cast<int>(module_->export_table.size());
+       export_index < end; ++export_index) {
+    const WasmExport& exp = module_->export_table[export_index];
+    Handle<String> name(String::cast(export_names->get(export_index)),
+                        isolate_);
     Handle<Object> value;
     switch (exp.kind) {
       case kExternalFunction: {
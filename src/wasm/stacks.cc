@@ -5,7 +5,9 @@
 #include "src/wasm/stacks.h"
 
 #include "src/base/platform/platform.h"
+#include "src/execution/isolate.h"
 #include "src/execution/simulator.h"
+#include "src/logging/counters.h"
 
 namespace v8::internal::wasm {
 
@@ -15,14 +17,64 @@ StackMemory* StackMemory::GetCurrentStackView(Isolate* isolate) {
   return new StackMemory(isolate, view.begin(), view.size());
 }
 
+StackPool::~StackPool() {
+  for (base::Vector<uint8_t> segment : freelist_) FreePages(segment);
+}
+
+base::Vector<uint8_t> StackPool::Allocate(size_t size) {
+  // Prefer the most recently freed segment, its pages are more likely to still
+  // be resident.
+  for (auto it = freelist_.rbegin(); it != freelist_.rend(); ++it) {
+    if (it->size() != size) continue;
+    base::Vector<uint8_t> segment = *it;
+    freelist_.erase(std::next(it).base());
+    pooled_size_ -= size;
+    ++reused_count_;
+    counters_->wasm_reused_stacks()->Increment();
+    return segment;
+  }
+  PageAllocator* allocator = GetPlatformPageAllocator();
+  void* limit = allocator->AllocatePages(
+      nullptr, size, allocator->AllocatePageSize(), PageAllocator::kReadWrite);
+  if (limit == nullptr) {
+    V8::FatalProcessOutOfMemory(nullptr, "Allocate stack memory");
+  }
+  allocated_size_ += size;
+  return {static_cast<uint8_t*>(limit), size};
+}
+
+void StackPool::Free(base::Vector<uint8_t> segment) {
+  size_t max_pooled_size =
+      static_cast<size_t>(v8_flags.wasm_stack_pool_size) * KB;
+  if (pooled_size_ + segment.size() > max_pooled_size) {
+    FreePages(segment);
+    return;
+  }
+  // Release the physical pages, but keep the reservation for the next stack of
+  // the same size.
+  PageAllocator* allocator = GetPlatformPageAllocator();
+  if (!allocator->DiscardSystemPages(segment.begin(), segment.size())) {
+    FreePages(segment);
+    return;
+  }
+  freelist_.push_back(segment);
+  pooled_size_ += segment.size();
+}
+
+void StackPool::FreePages(base::Vector<uint8_t> segment) {
+  PageAllocator* allocator = GetPlatformPageAllocator();
+  if (!allocator->FreePages(segment.begin(), segment.size())) {
+    V8::FatalProcessOutOfMemory(nullptr, "Free stack memory");
+  }
+  DCHECK_GE(allocated_size_, segment.size());
+  allocated_size_ -= segment.size();
+}
+
 StackMemory::~StackMemory() {
   if (v8_flags.trace_wasm_stack_switching) {
     PrintF("Delete stack #%d\n", id_);
   }
-  PageAllocator* allocator = GetPlatformPageAllocator();
-  if (owned_ && !allocator->DecommitPages(limit_, size_)) {
-    V8::FatalProcessOutOfMemory(nullptr, "Decommit stack memory");
-  }
+  if (owned_) isolate_->wasm_stack_pool()->Free({limit_, size_});
   // We don't need to handle removing the last stack from the list (next_ ==
   // this). This only happens on isolate tear down, otherwise there is always
   // at least one reachable stack (the active stack).
@@ -45,9 +97,7 @@ StackMemory::StackMemory(Isolate* isolate) : isolate_(isolate), owned_(true) {
   int kJsStackSizeKB = v8_flags.wasm_stack_switching_stack_size;
   size_ = (kJsStackSizeKB + kJSLimitOffsetKB) * KB;
   size_ = RoundUp(size_, allocator->AllocatePageSize());
-  limit_ = static_cast<uint8_t*>(
-      allocator->AllocatePages(nullptr, size_, allocator->AllocatePageSize(),
-                               PageAllocator::kReadWrite));
+  limit_ = isolate->wasm_stack_pool()->Allocate(size_).begin();
   if (v8_flags.trace_wasm_stack_switching) {
     PrintF("Allocate stack #%d (limit: %p, base: %p)\n", id_, limit_,
            limit_ + size_);
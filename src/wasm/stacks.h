@@ -9,12 +9,18 @@
 #error This header should only be included if WebAssembly is enabled.
 #endif  // !V8_ENABLE_WEBASSEMBLY
 
+#include <vector>
+
+#include "src/base/vector.h"
 #include "src/common/globals.h"
 #include "src/utils/allocation.h"
 
 namespace v8 {
 class Isolate;
-}
+namespace internal {
+class Counters;
+}  // namespace internal
+}  // namespace v8
 
 namespace v8::internal::wasm {
 
@@ -33,6 +39,41 @@ constexpr int kJmpBufPcOffset = offsetof(JumpBuffer, pc);
 constexpr int kJmpBufStackLimitOffset = offsetof(JumpBuffer, stack_limit);
 constexpr int kJmpBufStateOffset = offsetof(JumpBuffer, state);
 
+// Allocates the memory of secondary stacks, and keeps the memory of stacks
+// that were freed for reuse, up to {v8_flags.wasm_stack_pool_size}. This
+// avoids an mmap/munmap pair for every suspender when many coroutines are
+// created and retired. Pooled segments are bucketed by their exact size, which
+// is the size class of all stacks allocated with the same flags.
+class StackPool {
+ public:
+  explicit StackPool(Counters* counters) : counters_(counters) {}
+  StackPool(const StackPool&) = delete;
+  StackPool& operator=(const StackPool&) = delete;
+  ~StackPool();
+
+  // Returns a read-write segment of {size} bytes, reusing a pooled one if
+  // possible.
+  base::Vector<uint8_t> Allocate(size_t size);
+  // Returns {segment} to the pool, or frees it if the pool is full.
+  void Free(base::Vector<uint8_t> segment);
+
+  // Bytes in all stack segments owned by the isolate, including pooled ones.
+  size_t allocated_size() const { return allocated_size_; }
+  // Bytes in pooled segments, which are ready for reuse.
+  size_t pooled_size() const { return pooled_size_; }
+  // Number of allocations that were served from the pool.
+  size_t reused_count() const { return reused_count_; }
+
+ private:
+  void FreePages(base::Vector<uint8_t> segment);
+
+  Counters* const counters_;
+  std::vector<base::Vector<uint8_t>> freelist_;
+  size_t allocated_size_ = 0;
+  size_t pooled_size_ = 0;
+  size_t reused_count_ = 0;
+};
+
 class StackMemory {
  public:
   static StackMemory* New(Isolate* isolate) { return new StackMemory(isolate); }
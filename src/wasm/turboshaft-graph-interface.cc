@@ -3061,6 +3061,29 @@ class TurboshaftGraphBuildingInterface {
                         const Value& array_index, const Value& segment_offset,
                         const Value& length) {
     bool is_element = array_imm.array_type->element_type().is_reference();
+    if (!is_element) {
+      // Data segments are copied without leaving wasm code: check the array
+      // range here, and let the C function check the segment range and copy
+      // the bytes.
+      BoundsCheckArrayWithLength(array.op, array_index.op, length.op,
+                                 array.type.is_nullable()
+                                     ? compiler::kWithNullCheck
+                                     : compiler::kWithoutNullCheck);
+      auto sig =
+          FixedSizeSignature<MachineType>::Returns(MachineType::Int32())
+              .Params(MachineType::Pointer(), MachineType::TaggedPointer(),
+                      MachineType::Uint32(), MachineType::Uint32(),
+                      MachineType::Uint32(), MachineType::Uint32());
+      V<Word32> result =
+          CallC(&sig, ExternalReference::wasm_array_init_data(),
+                {__ BitcastHeapObjectToWordPtr(trusted_instance_data()),
+                 array.op, array_index.op,
+                 __ Word32Constant(segment_imm.index), segment_offset.op,
+                 length.op});
+      __ TrapIfNot(result, OpIndex::Invalid(),
+                   TrapId::kTrapDataSegmentOutOfBounds);
+      return;
+    }
     CallBuiltinThroughJumptable<BuiltinCallDescriptor::WasmArrayInitSegment>(
         decoder, {array_index.op, segment_offset.op, length.op,
                   __ SmiConstant(Smi::FromInt(segment_imm.index)),
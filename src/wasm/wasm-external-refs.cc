@@ -555,6 +555,40 @@ void array_copy_wrapper(Address raw_trusted_data, Address raw_dst_array,
   }
 }
 
+int32_t array_init_data_wrapper(Address trusted_data_addr, Address raw_array,
+                                uint32_t array_index, uint32_t segment_index,
+                                uint32_t segment_offset, uint32_t length) {
+  ThreadNotInWasmScope thread_not_in_wasm_scope;
+  DisallowGarbageCollection no_gc;
+  Tagged<WasmTrustedInstanceData> trusted_data =
+      Tagged<WasmTrustedInstanceData>::cast(Tagged<Object>{trusted_data_addr});
+  Tagged<WasmArray> array = WasmArray::cast(Tagged<Object>(raw_array));
+  wasm::ValueType element_type = array->type()->element_type();
+  DCHECK(element_type.is_numeric());
+  DCHECK(base::IsInBounds<uint32_t>(array_index, length, array->length()));
+  uint32_t element_size = element_type.value_kind_size();
+  // No chance of overflow, due to the array bounds check and the limit in
+  // array length.
+  uint32_t length_in_bytes = length * element_size;
+
+  uint32_t seg_size = trusted_data->data_segment_sizes()->get(segment_index);
+  if (!base::IsInBounds<uint32_t>(segment_offset, length_in_bytes, seg_size)) {
+    return kOutOfBounds;
+  }
+  if (length == 0) return kSuccess;
+
+  void* source = reinterpret_cast<void*>(
+      trusted_data->data_segment_starts()->get(segment_index) +
+      segment_offset);
+  void* dest = ArrayElementAddress(array, array_index, element_size);
+#if V8_TARGET_BIG_ENDIAN
+  MemCopyAndSwitchEndianness(dest, source, length, element_size);
+#else
+  MemCopy(dest, source, length_in_bytes);
+#endif
+  return kSuccess;
+}
+
 void array_fill_wrapper(Address raw_array, uint32_t index, uint32_t length,
                         uint32_t emit_write_barrier, uint32_t raw_type,
                         Address initial_value_addr) {
@@ -118,6 +118,14 @@ void array_copy_wrapper(Address raw_instance, Address raw_dst_array,
                         uint32_t dst_index, Address raw_src_array,
                         uint32_t src_index, uint32_t length);
 
+// Copies {length} elements from a data segment into an array of numeric
+// element type. Assumes the array range is in-bounds. The return type is
+// {int32_t} instead of {bool} to enforce the compiler to zero-extend the result
+// in the return register; 0 means the data segment range is out of bounds.
+int32_t array_init_data_wrapper(Address trusted_data_addr, Address raw_array,
+                                uint32_t array_index, uint32_t segment_index,
+                                uint32_t segment_offset, uint32_t length);
+
 // The initial value is passed as an int64_t on the stack. Cannot handle s128
 // other than 0.
 void array_fill_wrapper(Address raw_array, uint32_t index, uint32_t length,
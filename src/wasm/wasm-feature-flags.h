@@ -48,7 +48,13 @@
   /* JavaScript Promise Integration proposal. */                               \
   /* https://github.com/WebAssembly/js-promise-integration */                  \
   /* V8 side owner: thibaudm, fgm */                                           \
-  V(jspi, "javascript promise integration", false)
+  V(jspi, "javascript promise integration", false)                             \
+                                                                               \
+  /* Shared-Everything Threads proposal. */                                    \
+  /* https://github.com/WebAssembly/shared-everything-threads */               \
+  /* Only the shared bit of globals is decoded and validated so far; */        \
+  /* nothing is shared between threads yet. */                                 \
+  V(shared, "shared-everything threads (decoding only)", false)
 
 // #############################################################################
 // Staged features (disabled by default, but enabled via --wasm-staging (also
@@ -4,8 +4,10 @@
 
 #include "src/wasm/wasm-import-wrapper-cache.h"
 
+#include <algorithm>
 #include <vector>
 
+#include "src/base/bits.h"
 #include "src/wasm/std-object-sizes.h"
 #include "src/wasm/wasm-code-manager.h"
 
@@ -13,9 +15,122 @@ namespace v8 {
 namespace internal {
 namespace wasm {
 
+// Linear-probing hash table with a capacity that is a power of two and a load
+// factor of at most 1/2. Slots are only ever filled (never emptied), and the
+// key of a slot is written before its code is published with release
+// semantics, so readers can probe concurrently with the (single, locked)
+// writer.
+class WasmImportWrapperCache::LookupTable {
+ public:
+  explicit LookupTable(size_t capacity)
+      : capacity_(capacity), slots_(new Slot[capacity]) {
+    DCHECK(base::bits::IsPowerOfTwo(capacity));
+  }
+
+  size_t capacity() const { return capacity_; }
+
+  WasmCode* Lookup(const CacheKey& key) const {
+    const size_t mask = capacity_ - 1;
+    for (size_t i = CacheKeyHash{}(key) & mask;; i = (i + 1) & mask) {
+      WasmCode* code = slots_[i].code.load(std::memory_order_acquire);
+      if (code == nullptr) return nullptr;
+      if (slots_[i].key == key) return code;
+    }
+  }
+
+  // Only called while holding the cache's mutex.
+  void Insert(const CacheKey& key, WasmCode* code) {
+    DCHECK_NOT_NULL(code);
+    const size_t mask = capacity_ - 1;
+    for (size_t i = CacheKeyHash{}(key) & mask;; i = (i + 1) & mask) {
+      Slot& slot = slots_[i];
+      WasmCode* old_code = slot.code.load(std::memory_order_relaxed);
+      if (old_code == nullptr) {
+        slot.key = key;
+        slot.code.store(code, std::memory_order_release);
+        return;
+      }
+      if (slot.key == key) {
+        if (old_code != code) slot.code.store(code, std::memory_order_release);
+        return;
+      }
+    }
+  }
+
+ private:
+  struct Slot {
+    CacheKey key{ImportCallKind::kLinkError, 0, 0, kNoSuspend};
+    std::atomic<WasmCode*> code{nullptr};
+  };
+
+  const size_t capacity_;
+  const std::unique_ptr<Slot[]> slots_;
+};
+
+WasmImportWrapperCache::ModificationScope::~ModificationScope() {
+  cache_->PublishEntries();
+}
+
 WasmCode*& WasmImportWrapperCache::ModificationScope::operator[](
     const CacheKey& key) {
-  return cache_->entry_map_[key];
+  return (*cache_)[key];
+}
+
+WasmCode*& WasmImportWrapperCache::ModificationScope::ExistingEntry(
+    const CacheKey& key) {
+  auto it = cache_->entry_map_.find(key);
+  DCHECK(it != cache_->entry_map_.end());
+  return it->second;
+}
+
+WasmImportWrapperCache::WasmImportWrapperCache() = default;
+
+WasmImportWrapperCache::~WasmImportWrapperCache() { clear(); }
+
+void WasmImportWrapperCache::PublishEntries() {
+  mutex_.AssertHeld();
+  if (keys_to_publish_.empty()) return;
+  // Keep the load factor at or below 1/2, so that probing is fast and always
+  // terminates.
+  constexpr size_t kMinCapacity = 16;
+  size_t required_capacity = std::max(
+      kMinCapacity, base::bits::RoundUpToPowerOfTwo(2 * entry_map_.size()));
+  if (current_lookup_table_ &&
+      current_lookup_table_->capacity() >= required_capacity) {
+    for (const CacheKey& key : keys_to_publish_) {
+      WasmCode* code = entry_map_[key];
+      // Entries for wrappers which are still being compiled are published by
+      // a later scope.
+      if (code) current_lookup_table_->Insert(key, code);
+    }
+  } else {
+    // Growing doubles the capacity, so copying all entries here costs
+    // amortized constant time per entry.
+    auto table = std::make_unique<LookupTable>(required_capacity);
+    for (auto& [key, code] : entry_map_) {
+      if (code) table->Insert(key, code);
+    }
+    // Publish the new table after it was filled. Readers might still use the
+    // old one, which is retired until they are done.
+    lookup_table_.store(table.get(), std::memory_order_seq_cst);
+    if (current_lookup_table_) {
+      retired_lookup_tables_.push_back(std::move(current_lookup_table_));
+    }
+    current_lookup_table_ = std::move(table);
+  }
+  keys_to_publish_.clear();
+  MaybeFreeRetiredLookupTables();
+}
+
+void WasmImportWrapperCache::MaybeFreeRetiredLookupTables() {
+  mutex_.AssertHeld();
+  if (retired_lookup_tables_.empty()) return;
+  // Readers register in {active_readers_} before loading {lookup_table_}, and
+  // all of these accesses are sequentially consistent. So if no reader is
+  // registered now, all later readers load a table that was published after
+  // the retired ones were replaced.
+  if (active_readers_.load(std::memory_order_seq_cst) != 0) return;
+  retired_lookup_tables_.clear();
 }
 
 void WasmImportWrapperCache::clear() {
@@ -28,6 +143,11 @@ void WasmImportWrapperCache::clear() {
       if (code) ptrs.push_back(code);
     }
     entry_map_.clear();
+    keys_to_publish_.clear();
+    // There cannot be concurrent readers when the cache is cleared.
+    lookup_table_.store(nullptr, std::memory_order_relaxed);
+    current_lookup_table_.reset();
+    retired_lookup_tables_.clear();
   }
   if (ptrs.empty()) return;
   WasmCode::DecrementRefCount(base::VectorOf(ptrs));
@@ -35,6 +155,7 @@ void WasmImportWrapperCache::clear() {
 
 WasmCode*& WasmImportWrapperCache::operator[](
     const WasmImportWrapperCache::CacheKey& key) {
+  keys_to_publish_.push_back(key);
   return entry_map_[key];
 }
 
@@ -42,30 +163,41 @@ WasmCode* WasmImportWrapperCache::Get(ImportCallKind kind,
                                       uint32_t canonical_type_index,
                                       int expected_arity,
                                       Suspend suspend) const {
-  base::MutexGuard lock(&mutex_);
-
-  auto it =
-      entry_map_.find({kind, canonical_type_index, expected_arity, suspend});
-  DCHECK(it != entry_map_.end());
-  return it->second;
+  WasmCode* code =
+      MaybeGet(kind, canonical_type_index, expected_arity, suspend);
+  DCHECK_NOT_NULL(code);
+  return code;
 }
 
 WasmCode* WasmImportWrapperCache::MaybeGet(ImportCallKind kind,
                                            uint32_t canonical_type_index,
                                            int expected_arity,
                                            Suspend suspend) const {
-  base::MutexGuard lock(&mutex_);
-
-  auto it =
-      entry_map_.find({kind, canonical_type_index, expected_arity, suspend});
-  if (it == entry_map_.end()) return nullptr;
-  return it->second;
+  active_readers_.fetch_add(1, std::memory_order_seq_cst);
+  const LookupTable* table = lookup_table_.load(std::memory_order_seq_cst);
+  WasmCode* code = nullptr;
+  if (table != nullptr) {
+    code = table->Lookup({kind, canonical_type_index, expected_arity, suspend});
+  }
+  active_readers_.fetch_sub(1, std::memory_order_release);
+  return code;
 }
 
 size_t WasmImportWrapperCache::EstimateCurrentMemoryConsumption() const {
-  UPDATE_WHEN_CLASS_CHANGES(WasmImportWrapperCache, 88);
+  UPDATE_WHEN_CLASS_CHANGES(WasmImportWrapperCache, 160);
   base::MutexGuard lock(&mutex_);
-  return sizeof(WasmImportWrapperCache) + ContentSize(entry_map_);
+  size_t result = sizeof(WasmImportWrapperCache) + ContentSize(entry_map_) +
+                  ContentSize(retired_lookup_tables_) +
+                  ContentSize(keys_to_publish_);
+  auto table_size = [](const LookupTable& table) {
+    return sizeof(LookupTable) +
+           table.capacity() * (sizeof(CacheKey) + sizeof(WasmCode*));
+  };
+  if (current_lookup_table_) result += table_size(*current_lookup_table_);
+  for (const auto& table : retired_lookup_tables_) {
+    result += table_size(*table);
+  }
+  return result;
 }
 
 }  // namespace wasm
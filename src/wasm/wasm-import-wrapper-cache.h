@@ -9,6 +9,10 @@
 #ifndef V8_WASM_WASM_IMPORT_WRAPPER_CACHE_H_
 #define V8_WASM_WASM_IMPORT_WRAPPER_CACHE_H_
 
+#include <atomic>
+#include <memory>
+#include <vector>
+
 #include "src/base/platform/mutex.h"
 #include "src/wasm/module-instantiate.h"
 
@@ -25,6 +29,14 @@ class WasmEngine;
 using FunctionSig = Signature<ValueType>;
 
 // Implements a cache for import wrappers.
+// Modifications happen under a lock (see {ModificationScope}). When a
+// {ModificationScope} ends, the entries it modified are published into an
+// open-addressing lookup table, so that {Get} and {MaybeGet} never need to
+// take the lock. Lookup tables are only ever grown by replacing them
+// (read-copy-update); replaced tables are freed once no reader is probing
+// any table anymore.
+// Each NativeModule has its own cache; wrappers are not shared between
+// modules, since they live in the code space of their module.
 class WasmImportWrapperCache {
  public:
   struct CacheKey {
@@ -55,20 +67,29 @@ class WasmImportWrapperCache {
     }
   };
 
-  // Helper class to modify the cache under a lock.
+  // Helper class to modify the cache under a lock. Modifications become
+  // visible to {Get} and {MaybeGet} when the scope ends.
   class V8_NODISCARD ModificationScope {
    public:
     explicit ModificationScope(WasmImportWrapperCache* cache)
         : cache_(cache), guard_(&cache->mutex_) {}
+    V8_EXPORT_PRIVATE ~ModificationScope();
 
     V8_EXPORT_PRIVATE WasmCode*& operator[](const CacheKey& key);
 
+    // Returns the entry for {key}, which {operator[]} must already have added
+    // in this scope. Unlike {operator[]}, this neither inserts an entry nor
+    // records the key, so several threads can fill in the entries of
+    // different keys concurrently (see {CompileImportWrapper}).
+    V8_EXPORT_PRIVATE WasmCode*& ExistingEntry(const CacheKey& key);
+
    private:
     WasmImportWrapperCache* const cache_;
     base::MutexGuard guard_;
   };
 
-  ~WasmImportWrapperCache() { clear(); }
+  WasmImportWrapperCache();
+  ~WasmImportWrapperCache();
 
   // Clear this cache, dropping all reference counts.
   void clear();
@@ -77,19 +98,43 @@ class WasmImportWrapperCache {
   // cache.
   V8_EXPORT_PRIVATE WasmCode*& operator[](const CacheKey& key);
 
-  // Thread-safe. Assumes the key exists in the map.
+  // Thread-safe and lock-free. Assumes the key exists in the map.
   V8_EXPORT_PRIVATE WasmCode* Get(ImportCallKind kind,
                                   uint32_t canonical_type_index,
                                   int expected_arity, Suspend suspend) const;
-  // Thread-safe. Returns nullptr if the key doesn't exist in the map.
-  WasmCode* MaybeGet(ImportCallKind kind, uint32_t canonical_type_index,
-                     int expected_arity, Suspend suspend) const;
+  // Thread-safe and lock-free. Returns nullptr if the key doesn't exist in the
+  // map.
+  V8_EXPORT_PRIVATE WasmCode* MaybeGet(ImportCallKind kind,
+                                       uint32_t canonical_type_index,
+                                       int expected_arity,
+                                       Suspend suspend) const;
 
   size_t EstimateCurrentMemoryConsumption() const;
 
  private:
+  class LookupTable;
+
+  // Copies the compiled entries for {keys_to_publish_} into the lookup table.
+  // If the table has to grow, a new table with all compiled entries of
+  // {entry_map_} replaces it. Must be called while holding {mutex_}.
+  void PublishEntries();
+
+  // Frees the replaced lookup tables if no reader can still be probing them.
+  // Must be called while holding {mutex_}.
+  void MaybeFreeRetiredLookupTables();
+
   mutable base::Mutex mutex_;
   std::unordered_map<CacheKey, WasmCode*, CacheKeyHash> entry_map_;
+  // The table used by lock-free readers. Owned by {current_lookup_table_}.
+  std::atomic<const LookupTable*> lookup_table_{nullptr};
+  // The following fields are protected by {mutex_}.
+  std::unique_ptr<LookupTable> current_lookup_table_;
+  // Replaced lookup tables which readers might still be probing.
+  std::vector<std::unique_ptr<LookupTable>> retired_lookup_tables_;
+  // Keys modified since the last call to {PublishEntries}.
+  std::vector<CacheKey> keys_to_publish_;
+  // Number of {MaybeGet} calls currently probing a lookup table.
+  mutable std::atomic<int> active_readers_{0};
 };
 
 }  // namespace wasm
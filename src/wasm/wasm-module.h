@@ -75,6 +75,7 @@ struct WasmFunction {
 struct WasmGlobal {
   ValueType type;           // type of the global.
   bool mutability;          // {true} if mutable.
+  bool shared;              // {true} if declared shared; not shared yet.
   ConstantExpression init;  // the initialization expression of the global.
   union {
     // Index of imported mutable global.
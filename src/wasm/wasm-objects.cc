@@ -105,6 +105,54 @@ Handle<String> WasmModuleObject::ExtractUtf8StringFromModuleBytes(
                    .ToHandleChecked();
 }
 
+// static
+Handle<FixedArray> WasmModuleObject::GetOrCreateImportNames(
+    Isolate* isolate, Handle<WasmModuleObject> module_object) {
+  Tagged<Object> cached = module_object->import_names();
+  if (!IsUndefined(cached, isolate)) {
+    return handle(FixedArray::cast(cached), isolate);
+  }
+  const WasmModule* module = module_object->module();
+  base::Vector<const uint8_t> wire_bytes =
+      module_object->native_module()->wire_bytes();
+  int num_imports = static_cast<int>(module->import_table.size());
+  Handle<FixedArray> names =
+      isolate->factory()->NewFixedArray(2 * num_imports, AllocationType::kOld);
+  for (int index = 0; index < num_imports; ++index) {
+    const wasm::WasmImport& import = module->import_table[index];
+    Handle<String> module_name = ExtractUtf8StringFromModuleBytes(
+        isolate, wire_bytes, import.module_name, kInternalize);
+    names->set(2 * index, *module_name);
+    Handle<String> field_name = ExtractUtf8StringFromModuleBytes(
+        isolate, wire_bytes, import.field_name, kInternalize);
+    names->set(2 * index + 1, *field_name);
+  }
+  module_object->set_import_names(*names);
+  return names;
+}
+
+// static
+Handle<FixedArray> WasmModuleObject::GetOrCreateExportNames(
+    Isolate* isolate, Handle<WasmModuleObject> module_object) {
+  Tagged<Object> cached = module_object->export_names();
+  if (!IsUndefined(cached, isolate)) {
+    return handle(FixedArray::cast(cached), isolate);
+  }
+  const WasmModule* module = module_object->module();
+  base::Vector<const uint8_t> wire_bytes =
+      module_object->native_module()->wire_bytes();
+  int num_exports = static_cast<int>(module->export_table.size());
+  Handle<FixedArray> names =
+      isolate->factory()->NewFixedArray(num_exports, AllocationType::kOld);
+  for (int index = 0; index < num_exports; ++index) {
+    Handle<String> name = ExtractUtf8StringFromModuleBytes(
+        isolate, wire_bytes, module->export_table[index].name, kInternalize);
+    names->set(index, *name);
+  }
+  module_object->set_export_names(*names);
+  return names;
+}
+
 MaybeHandle<String> WasmModuleObject::GetModuleNameOrNull(
     Isolate* isolate, Handle<WasmModuleObject> module_object) {
   const WasmModule* module = module_object->module();
@@ -176,6 +176,18 @@ class WasmModuleObject
       Isolate*, base::Vector<const uint8_t> wire_byte, wasm::WireBytesRef,
       InternalizeString);
 
+  // Get the internalized names of all imports, with module name and field name
+  // of import {i} stored at {2 * i} and {2 * i + 1}. The array is created on
+  // first use and cached on the module object, such that instantiating the
+  // same module many times does not decode and internalize the names again.
+  static Handle<FixedArray> GetOrCreateImportNames(Isolate*,
+                                                   Handle<WasmModuleObject>);
+
+  // Same as above, for the names of all exports, indexed like the module's
+  // export table.
+  static Handle<FixedArray> GetOrCreateExportNames(Isolate*,
+                                                   Handle<WasmModuleObject>);
+
   TQ_OBJECT_CONSTRUCTORS(WasmModuleObject)
 };
 
@@ -0,0 +1,129 @@
+// Copyright 2024 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+// Measures string internalization throughput when several isolates share one
+// string table, i.e. contention on the string table's write lock. Compares
+// StringTable::LookupKeys, which inserts a whole batch of keys under one
+// acquisition of the write lock, with calling StringTable::LookupKey for every
+// key, which takes the lock once per new string.
+
+#include <algorithm>
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "include/libplatform/libplatform.h"
+#include "include/v8-array-buffer.h"
+#include "include/v8-initialization.h"
+#include "include/v8-isolate.h"
+#include "include/v8-platform.h"
+#include "src/base/lazy-instance.h"
+#include "src/base/macros.h"
+#include "src/base/vector.h"
+#include "src/execution/isolate.h"
+#include "src/handles/handles-inl.h"
+#include "src/numbers/hash-seed-inl.h"
+#include "src/objects/string-inl.h"
+#include "src/objects/string-table.h"
+#include "third_party/google_benchmark_chrome/src/include/benchmark/benchmark.h"
+
+namespace {
+
+namespace i = v8::internal;
+
+class V8Environment {
+ public:
+  V8Environment() : platform_(v8::platform::NewDefaultPlatform()) {
+    v8::V8::SetFlagsFromString("--shared-string-table");
+    v8::V8::InitializePlatform(platform_.get());
+    v8::V8::Initialize();
+  }
+
+ private:
+  std::unique_ptr<v8::Platform> platform_;
+};
+
+void EnsureV8Initialized() {
+  static v8::base::LeakyObject<V8Environment> environment;
+  USE(environment);
+}
+
+// Each thread internalizes {kStringsPerIteration} strings per iteration. Half
+// of them are shared between threads (and already internalized after the
+// first iteration), the other half are new in every iteration.
+constexpr size_t kStringsPerIteration = 1000;
+// Same batch size as AstValueFactory::Internalize.
+constexpr size_t kBatchSize = 64;
+
+enum class LookupMode { kPerKey, kBatched };
+
+template <LookupMode mode>
+void BM_InternalizeSharedStringTable(benchmark::State& state) {
+  EnsureV8Initialized();
+  std::unique_ptr<v8::ArrayBuffer::Allocator> allocator(
+      v8::ArrayBuffer::Allocator::NewDefaultAllocator());
+  v8::Isolate::CreateParams create_params;
+  create_params.array_buffer_allocator = allocator.get();
+  v8::Isolate* isolate = v8::Isolate::New(create_params);
+  {
+    v8::Isolate::Scope isolate_scope(isolate);
+    i::Isolate* i_isolate = reinterpret_cast<i::Isolate*>(isolate);
+    i::StringTable* string_table = i_isolate->string_table();
+    uint64_t seed = i::HashSeed(i_isolate);
+    std::vector<std::string> shared_names;
+    for (size_t index = 0; index < kStringsPerIteration / 2; ++index) {
+      shared_names.push_back("shared_identifier_" + std::to_string(index));
+    }
+    std::string unique_prefix =
+        "thread_" + std::to_string(state.thread_index()) + "_";
+    std::vector<std::string> names(kStringsPerIteration);
+    std::vector<i::OneByteStringKey> keys;
+    keys.reserve(kStringsPerIteration);
+    i::Handle<i::String> results[kBatchSize];
+    int iteration = 0;
+    for (auto _ : state) {
+      i::HandleScope handle_scope(i_isolate);
+      keys.clear();
+      for (size_t index = 0; index < kStringsPerIteration / 2; ++index) {
+        names[2 * index] = shared_names[index];
+        names[2 * index + 1] = unique_prefix + std::to_string(iteration) +
+                               "_" + std::to_string(index);
+      }
+      for (const std::string& name : names) {
+        keys.emplace_back(v8::base::OneByteVector(name.data(), name.size()),
+                          seed);
+      }
+      for (size_t start = 0; start < keys.size(); start += kBatchSize) {
+        size_t count = std::min(kBatchSize, keys.size() - start);
+        if (mode == LookupMode::kBatched) {
+          string_table->LookupKeys(
+              i_isolate, v8::base::VectorOf(keys.data() + start, count),
+              results);
+        } else {
+          for (size_t index = 0; index < count; ++index) {
+            results[index] =
+                string_table->LookupKey(i_isolate, &keys[start + index]);
+          }
+        }
+        benchmark::DoNotOptimize(results);
+      }
+      ++iteration;
+    }
+    state.SetItemsProcessed(state.iterations() * kStringsPerIteration);
+  }
+  isolate->Dispose();
+}
+
+}  // namespace
+
+BENCHMARK_TEMPLATE(BM_InternalizeSharedStringTable, LookupMode::kPerKey)
+    ->Threads(1)
+    ->Threads(4)
+    ->Threads(16)
+    ->UseRealTime();
+BENCHMARK_TEMPLATE(BM_InternalizeSharedStringTable, LookupMode::kBatched)
+    ->Threads(1)
+    ->Threads(4)
+    ->Threads(16)
+    ->UseRealTime();
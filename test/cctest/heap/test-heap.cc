@@ -1139,6 +1139,117 @@ TEST(TestBytecodeFlushing) {
   }
 }
 
+UNINITIALIZED_TEST(TestCompressedBytecodeFlushing) {
+#if !defined(V8_LITE_MODE) && defined(V8_ENABLE_TURBOFAN)
+  v8_flags.turbofan = false;
+  v8_flags.always_turbofan = false;
+  i::v8_flags.optimize_for_size = false;
+#endif  // !defined(V8_LITE_MODE) && defined(V8_ENABLE_TURBOFAN)
+#ifdef V8_ENABLE_SPARKPLUG
+  v8_flags.always_sparkplug = false;
+#endif  // V8_ENABLE_SPARKPLUG
+  i::v8_flags.flush_bytecode = true;
+  i::v8_flags.compress_flushed_bytecode = true;
+
+  v8::Isolate::CreateParams create_params;
+  create_params.array_buffer_allocator = CcTest::array_buffer_allocator();
+  v8::Isolate* isolate = v8::Isolate::New(create_params);
+  Isolate* i_isolate = reinterpret_cast<Isolate*>(isolate);
+  Heap* heap = i_isolate->heap();
+  {
+    v8::Isolate::Scope isolate_scope(isolate);
+    v8::HandleScope scope(isolate);
+    v8::Local<v8::Context> context = v8::Context::New(isolate);
+    v8::Context::Scope context_scope(context);
+    DisableConservativeStackScanningScopeForTesting no_stack_scanning(heap);
+
+    const char* source =
+        "function foo(a) {"
+        "  var inner = function() { return 'constant ' + a; };"
+        "  return inner();"
+        "};"
+        "foo(1)";
+    CompileRun(source);
+    Handle<JSFunction> function = Handle<JSFunction>::cast(
+        v8::Utils::OpenHandle(*CompileRun("foo")));
+    CHECK(function->shared()->is_compiled());
+
+    // Flushing keeps a compressed copy of the bytecode.
+    i::SharedFunctionInfo::EnsureOldForTesting(function->shared());
+    heap::InvokeMajorGC(heap);
+    CHECK(!function->shared()->is_compiled());
+    v8::HeapStatistics heap_statistics;
+    isolate->GetHeapStatistics(&heap_statistics);
+    CHECK_LT(0, heap_statistics.compressed_bytecode_size());
+    CHECK_EQ(0, heap_statistics.compressed_bytecode_hits());
+
+    // Calling foo restores the bytecode from the copy.
+    CHECK(CompileRun("foo(2) === 'constant 2'")->IsTrue());
+    CHECK(function->shared()->is_compiled());
+    isolate->GetHeapStatistics(&heap_statistics);
+    CHECK_EQ(0, heap_statistics.compressed_bytecode_size());
+    CHECK_EQ(1, heap_statistics.compressed_bytecode_hits());
+
+    // Copies that are not used are dropped under memory pressure.
+    i::SharedFunctionInfo::EnsureOldForTesting(function->shared());
+    heap::InvokeMajorGC(heap);
+    CHECK(!function->shared()->is_compiled());
+    isolate->LowMemoryNotification();
+    isolate->GetHeapStatistics(&heap_statistics);
+    CHECK_EQ(0, heap_statistics.compressed_bytecode_size());
+    CHECK_LT(0, heap_statistics.compressed_bytecode_evictions());
+    CHECK(CompileRun("foo(3) === 'constant 3'")->IsTrue());
+  }
+  isolate->Dispose();
+}
+
+UNINITIALIZED_TEST(TestCompressedBytecodeFlushingBudget) {
+#if !defined(V8_LITE_MODE) && defined(V8_ENABLE_TURBOFAN)
+  v8_flags.turbofan = false;
+  v8_flags.always_turbofan = false;
+  i::v8_flags.optimize_for_size = false;
+#endif  // !defined(V8_LITE_MODE) && defined(V8_ENABLE_TURBOFAN)
+#ifdef V8_ENABLE_SPARKPLUG
+  v8_flags.always_sparkplug = false;
+#endif  // V8_ENABLE_SPARKPLUG
+  i::v8_flags.flush_bytecode = true;
+  i::v8_flags.compress_flushed_bytecode = true;
+  // No copy fits into the budget.
+  i::v8_flags.compressed_bytecode_max_size = 0;
+
+  v8::Isolate::CreateParams create_params;
+  create_params.array_buffer_allocator = CcTest::array_buffer_allocator();
+  v8::Isolate* isolate = v8::Isolate::New(create_params);
+  Isolate* i_isolate = reinterpret_cast<Isolate*>(isolate);
+  Heap* heap = i_isolate->heap();
+  {
+    v8::Isolate::Scope isolate_scope(isolate);
+    v8::HandleScope scope(isolate);
+    v8::Local<v8::Context> context = v8::Context::New(isolate);
+    v8::Context::Scope context_scope(context);
+    DisableConservativeStackScanningScopeForTesting no_stack_scanning(heap);
+
+    CompileRun("function foo(a) { return 'constant ' + a; }; foo(1)");
+    Handle<JSFunction> function = Handle<JSFunction>::cast(
+        v8::Utils::OpenHandle(*CompileRun("foo")));
+    CHECK(function->shared()->is_compiled());
+
+    i::SharedFunctionInfo::EnsureOldForTesting(function->shared());
+    heap::InvokeMajorGC(heap);
+    CHECK(!function->shared()->is_compiled());
+    v8::HeapStatistics heap_statistics;
+    isolate->GetHeapStatistics(&heap_statistics);
+    CHECK_EQ(0, heap_statistics.compressed_bytecode_size());
+    CHECK_LT(0, heap_statistics.compressed_bytecode_evictions());
+
+    // The function is recompiled instead.
+    CHECK(CompileRun("foo(2) === 'constant 2'")->IsTrue());
+    isolate->GetHeapStatistics(&heap_statistics);
+    CHECK_EQ(0, heap_statistics.compressed_bytecode_hits());
+  }
+  isolate->Dispose();
+}
+
 static void TestMultiReferencedBytecodeFlushing(bool sparkplug_compile) {
 #if !defined(V8_LITE_MODE) && defined(V8_ENABLE_TURBOFAN)
   v8_flags.turbofan = false;
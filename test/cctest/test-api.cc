@@ -8884,6 +8884,47 @@ THREADED_TEST(Utf16Trailing3Byte) {
 }
 
 
+THREADED_TEST(Utf8RoundTripMixedAsciiRuns) {
+  LocalContext context;
+  v8::Isolate* isolate = context->GetIsolate();
+  v8::HandleScope scope(isolate);
+
+  // ASCII runs of every length around the 16-byte block size, separated by
+  // Latin-1, BMP, astral and invalid sequences.
+  const char* separators[] = {"\xC3\xA9", "\xE2\x80\xA6", "\xF0\x9D\x80\x9E",
+                              "\xFF"};
+  for (const char* separator : separators) {
+    std::string utf8;
+    for (int run = 0; run < 40; run++) {
+      utf8.append(run, static_cast<char>('a' + run % 26));
+      utf8.append(separator);
+    }
+    v8::Local<v8::String> str =
+        v8::String::NewFromUtf8(isolate, utf8.data(),
+                                v8::NewStringType::kNormal,
+                                static_cast<int>(utf8.length()))
+            .ToLocalChecked();
+    // Invalid input decodes to U+FFFD, which encodes to 3 bytes.
+    std::string expected = utf8;
+    if (strcmp(separator, "\xFF") == 0) {
+      expected.clear();
+      for (int run = 0; run < 40; run++) {
+        expected.append(run, static_cast<char>('a' + run % 26));
+        expected.append("\xEF\xBF\xBD");
+      }
+    }
+    CHECK_EQ(static_cast<int>(expected.length()), str->Utf8Length(isolate));
+    std::vector<char> buffer(expected.length() + 1);
+    int nchars = -1;
+    CHECK_EQ(static_cast<int>(expected.length()) + 1,
+             str->WriteUtf8(isolate, buffer.data(),
+                            static_cast<int>(buffer.size()), &nchars));
+    CHECK_EQ(str->Length(), nchars);
+    CHECK_EQ(0, memcmp(expected.data(), buffer.data(), expected.length()));
+  }
+}
+
+
 THREADED_TEST(ToArrayIndex) {
   LocalContext context;
   v8::Isolate* isolate = context->GetIsolate();
@@ -20816,6 +20857,50 @@ THREADED_TEST(JSONStringifyObjectWithGap) {
   ExpectString("JSON.stringify(obj, null,  '*')", *utf8);
 }
 
+namespace {
+class StringUtf8Sink : public v8::JSON::Utf8Sink {
+ public:
+  void Append(const char* data, size_t length) override {
+    output.append(data, length);
+  }
+  std::string output;
+};
+
+void TestJSONStringifyToUtf8Buffer(Local<Context> context, const char* source) {
+  Local<Value> value = CompileRun(source);
+  Local<String> json = v8::JSON::Stringify(context, value).ToLocalChecked();
+  v8::String::Utf8Value expected(context->GetIsolate(), json);
+  StringUtf8Sink sink;
+  CHECK(v8::JSON::StringifyToUtf8Buffer(context, value, &sink).FromJust());
+  CHECK_EQ(std::string(*expected, expected.length()), sink.output);
+}
+}  // namespace
+
+THREADED_TEST(JSONStringifyToUtf8Buffer) {
+  LocalContext context;
+  HandleScope scope(context->GetIsolate());
+  TestJSONStringifyToUtf8Buffer(context.local(), "({x: 42, y: 'a\\nb'})");
+  TestJSONStringifyToUtf8Buffer(context.local(), "['\\u00fc', '\\u2603']");
+  TestJSONStringifyToUtf8Buffer(context.local(), "['\\ud83d\\ude00', 1.5]");
+  // Lone surrogates are escaped by JSON.stringify.
+  TestJSONStringifyToUtf8Buffer(context.local(), "['\\ud83d', '\\ude00']");
+  // Output larger than the internal buffer.
+  TestJSONStringifyToUtf8Buffer(context.local(),
+                                "['x'.repeat(10000) + '\\u00fc', 'y']");
+  TestJSONStringifyToUtf8Buffer(context.local(),
+                                "['\\u2603'.repeat(10000), 'x'.repeat(5000)]");
+  // Values without a JSON representation are written like by Stringify.
+  TestJSONStringifyToUtf8Buffer(context.local(), "undefined");
+
+  // Exceptions are propagated.
+  v8::TryCatch try_catch(context->GetIsolate());
+  Local<Value> cyclic = CompileRun("var cyclic = {}; cyclic.self = cyclic");
+  StringUtf8Sink sink;
+  CHECK(v8::JSON::StringifyToUtf8Buffer(context.local(), cyclic, &sink)
+            .IsNothing());
+  CHECK(try_catch.HasCaught());
+}
+
 #if V8_OS_POSIX
 class ThreadInterruptTest {
  public:
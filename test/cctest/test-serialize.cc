@@ -65,6 +65,7 @@
 #include "test/cctest/cctest.h"
 #include "test/cctest/heap/heap-utils.h"
 #include "test/cctest/setup-isolate-for-tests.h"
+#include "test/common/flag-utils.h"
 namespace v8 {
 namespace internal {
 
@@ -3007,6 +3008,53 @@ TEST(CodeSerializerIsolatesEager) {
   isolate2->Dispose();
 }
 
+TEST(ProcessWideScriptCacheIsolates) {
+  FLAG_SCOPE(process_wide_script_cache);
+  ProcessWideScriptCache* process_cache = ProcessWideScriptCache::Get();
+  process_cache->Clear();
+  const char* js_source = "function f() { return 'abc'; }; f() + 'def'";
+
+  v8::Isolate::CreateParams create_params;
+  create_params.array_buffer_allocator = CcTest::array_buffer_allocator();
+  for (const char* name : {"test1", "test2"}) {
+    v8::Isolate* isolate = v8::Isolate::New(create_params);
+    {
+      v8::Isolate::Scope iscope(isolate);
+      v8::HandleScope scope(isolate);
+      v8::Local<v8::Context> context = v8::Context::New(isolate);
+      v8::Context::Scope context_scope(context);
+
+      v8::ScriptOrigin origin(v8_str(name));
+      v8::ScriptCompiler::Source source(v8_str(js_source), origin);
+      v8::Local<v8::UnboundScript> script;
+      {
+        // Only the first isolate has to compile.
+        base::Optional<DisallowCompilation> no_compile;
+        if (process_cache->size_in_bytes() > 0) {
+          no_compile.emplace(reinterpret_cast<Isolate*>(isolate));
+        }
+        script = v8::ScriptCompiler::CompileUnboundScript(
+                     isolate, &source, v8::ScriptCompiler::kNoCompileOptions)
+                     .ToLocalChecked();
+      }
+      CHECK(script->GetScriptName()->StrictEquals(v8_str(name)));
+      v8::Local<v8::Value> result =
+          script->BindToCurrentContext()->Run(context).ToLocalChecked();
+      CHECK(result->ToString(context).ToLocalChecked()->Equals(
+                context, v8_str("abcdef"))
+                .FromJust());
+    }
+    isolate->Dispose();
+    CHECK_LT(0u, process_cache->size_in_bytes());
+  }
+
+  // Entries that are not looked up between two agings are evicted.
+  process_cache->Age();
+  CHECK_LT(0u, process_cache->size_in_bytes());
+  process_cache->Age();
+  CHECK_EQ(0u, process_cache->size_in_bytes());
+}
+
 TEST(CodeSerializerAfterExecute) {
   // We test that no compilations happen when running this code. Forcing
   // to always optimize breaks this test.
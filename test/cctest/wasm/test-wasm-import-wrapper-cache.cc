@@ -42,6 +42,10 @@ TEST(CacheHit) {
       GetTypeCanonicalizer()->AddRecursiveGroup(sig);
   int expected_arity = static_cast<int>(sig->parameter_count());
 
+  // CompileImportWrapper fills in an entry that was added before, like
+  // InstanceBuilder::CompileImportWrappers does.
+  CHECK_NULL(
+      cache_scope[{kind, canonical_type_index, expected_arity, kNoSuspend}]);
   WasmCode* c1 = CompileImportWrapper(module.get(), isolate->counters(), kind,
                                       sig, canonical_type_index, expected_arity,
                                       kNoSuspend, &cache_scope);
@@ -74,6 +78,8 @@ TEST(CacheMissSig) {
   uint32_t canonical_type_index2 =
       GetTypeCanonicalizer()->AddRecursiveGroup(sig2);
 
+  CHECK_NULL(
+      cache_scope[{kind, canonical_type_index1, expected_arity1, kNoSuspend}]);
   WasmCode* c1 = CompileImportWrapper(
       module.get(), isolate->counters(), kind, sig1, canonical_type_index1,
       expected_arity1, kNoSuspend, &cache_scope);
@@ -102,6 +108,8 @@ TEST(CacheMissKind) {
   uint32_t canonical_type_index =
       GetTypeCanonicalizer()->AddRecursiveGroup(sig);
 
+  CHECK_NULL(
+      cache_scope[{kind1, canonical_type_index, expected_arity, kNoSuspend}]);
   WasmCode* c1 = CompileImportWrapper(module.get(), isolate->counters(), kind1,
                                       sig, canonical_type_index, expected_arity,
                                       kNoSuspend, &cache_scope);
@@ -133,6 +141,8 @@ TEST(CacheHitMissSig) {
   uint32_t canonical_type_index2 =
       GetTypeCanonicalizer()->AddRecursiveGroup(sig2);
 
+  CHECK_NULL(
+      cache_scope[{kind, canonical_type_index1, expected_arity1, kNoSuspend}]);
   WasmCode* c1 = CompileImportWrapper(
       module.get(), isolate->counters(), kind, sig1, canonical_type_index1,
       expected_arity1, kNoSuspend, &cache_scope);
@@ -164,6 +174,83 @@ TEST(CacheHitMissSig) {
   CHECK_EQ(c2, c4);
 }
 
+TEST(CachePublishedOnScopeExit) {
+  Isolate* isolate = CcTest::InitIsolateOnce();
+  auto module = NewModule(isolate);
+  TestSignatures sigs;
+  WasmCodeRefScope wasm_code_ref_scope;
+  WasmImportWrapperCache* cache = module->import_wrapper_cache();
+
+  auto kind = ImportCallKind::kJSFunctionArityMatch;
+  auto sig = sigs.i_i();
+  uint32_t canonical_type_index =
+      GetTypeCanonicalizer()->AddRecursiveGroup(sig);
+  int expected_arity = static_cast<int>(sig->parameter_count());
+
+  WasmCode* c1;
+  {
+    WasmImportWrapperCache::ModificationScope cache_scope(cache);
+    CHECK_NULL(
+        cache_scope[{kind, canonical_type_index, expected_arity, kNoSuspend}]);
+    c1 = CompileImportWrapper(module.get(), isolate->counters(), kind, sig,
+                              canonical_type_index, expected_arity, kNoSuspend,
+                              &cache_scope);
+    CHECK_NOT_NULL(c1);
+    // Lock-free readers only see the entry once the scope ends.
+    CHECK_NULL(cache->MaybeGet(kind, canonical_type_index, expected_arity,
+                               kNoSuspend));
+  }
+
+  CHECK_EQ(c1, cache->MaybeGet(kind, canonical_type_index, expected_arity,
+                               kNoSuspend));
+  CHECK_EQ(c1,
+           cache->Get(kind, canonical_type_index, expected_arity, kNoSuspend));
+  CHECK_NULL(cache->MaybeGet(ImportCallKind::kJSFunctionArityMismatch,
+                             canonical_type_index, expected_arity,
+                             kNoSuspend));
+}
+
+TEST(CachePublishesEntriesOfEachScope) {
+  Isolate* isolate = CcTest::InitIsolateOnce();
+  auto module = NewModule(isolate);
+  TestSignatures sigs;
+  WasmCodeRefScope wasm_code_ref_scope;
+  WasmImportWrapperCache* cache = module->import_wrapper_cache();
+
+  auto kind = ImportCallKind::kJSFunctionArityMismatch;
+  auto sig = sigs.i_i();
+  uint32_t canonical_type_index =
+      GetTypeCanonicalizer()->AddRecursiveGroup(sig);
+  int expected_arity = static_cast<int>(sig->parameter_count());
+
+  WasmCode* code;
+  {
+    WasmImportWrapperCache::ModificationScope cache_scope(cache);
+    CHECK_NULL(
+        cache_scope[{kind, canonical_type_index, expected_arity, kNoSuspend}]);
+    code = CompileImportWrapper(module.get(), isolate->counters(), kind, sig,
+                                canonical_type_index, expected_arity,
+                                kNoSuspend, &cache_scope);
+  }
+
+  // One entry per scope, like the tier-up paths do. The lookup table grows
+  // several times on the way.
+  constexpr int kEntries = 100;
+  for (int i = 1; i <= kEntries; ++i) {
+    WasmImportWrapperCache::ModificationScope cache_scope(cache);
+    // The cache owns one reference per entry.
+    code->IncRef();
+    cache_scope[{kind, canonical_type_index, expected_arity + i,
+                 kNoSuspend}] = code;
+  }
+  for (int i = 0; i <= kEntries; ++i) {
+    CHECK_EQ(code, cache->MaybeGet(kind, canonical_type_index,
+                                   expected_arity + i, kNoSuspend));
+  }
+  CHECK_NULL(cache->MaybeGet(kind, canonical_type_index,
+                             expected_arity + kEntries + 1, kNoSuspend));
+}
+
 }  // namespace test_wasm_import_wrapper_cache
 }  // namespace wasm
 }  // namespace internal
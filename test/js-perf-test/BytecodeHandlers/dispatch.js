@@ -0,0 +1,102 @@
+// Copyright 2024 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+// The handlers exercised here do almost no work of their own, so the scores
+// mostly measure the cost of dispatching between bytecode handlers.
+
+function addBenchmark(name, test) {
+  new BenchmarkSuite(name, [1000],
+      [
+        new Benchmark(name, false, false, 0, test)
+      ]);
+}
+
+addBenchmark('Constant-Loads', ConstantLoads);
+addBenchmark('Register-Moves', RegisterMoves);
+addBenchmark('Null-Checks', NullChecks);
+addBenchmark('StrictEquals-Branch', StrictEqualsBranch);
+
+function constantLoads() {
+  var a, b, c, d;
+  for (var i = 0; i < 1000; ++i) {
+    a = 0; b = null; c = undefined; d = true; a = 1; b = false;
+    a = 0; b = null; c = undefined; d = true; a = 1; b = false;
+    a = 0; b = null; c = undefined; d = true; a = 1; b = false;
+    a = 0; b = null; c = undefined; d = true; a = 1; b = false;
+    a = 0; b = null; c = undefined; d = true; a = 1; b = false;
+    a = 0; b = null; c = undefined; d = true; a = 1; b = false;
+    a = 0; b = null; c = undefined; d = true; a = 1; b = false;
+    a = 0; b = null; c = undefined; d = true; a = 1; b = false;
+    a = 0; b = null; c = undefined; d = true; a = 1; b = false;
+    a = 0; b = null; c = undefined; d = true; a = 1; b = false;
+  }
+  return a + b + c + d;
+}
+
+function registerMoves(x) {
+  var a = x, b, c, d;
+  for (var i = 0; i < 1000; ++i) {
+    b = a; c = b; d = c; a = d; b = a; c = b; d = c; a = d;
+    b = a; c = b; d = c; a = d; b = a; c = b; d = c; a = d;
+    b = a; c = b; d = c; a = d; b = a; c = b; d = c; a = d;
+    b = a; c = b; d = c; a = d; b = a; c = b; d = c; a = d;
+    b = a; c = b; d = c; a = d; b = a; c = b; d = c; a = d;
+    b = a; c = b; d = c; a = d; b = a; c = b; d = c; a = d;
+    b = a; c = b; d = c; a = d; b = a; c = b; d = c; a = d;
+    b = a; c = b; d = c; a = d; b = a; c = b; d = c; a = d;
+    b = a; c = b; d = c; a = d; b = a; c = b; d = c; a = d;
+    b = a; c = b; d = c; a = d; b = a; c = b; d = c; a = d;
+  }
+  return a;
+}
+
+function nullChecks(a) {
+  var ret = 0;
+  for (var i = 0; i < 1000; ++i) {
+    if (a === null) ret = 1; if (a === undefined) ret = 2;
+    if (a === null) ret = 1; if (a === undefined) ret = 2;
+    if (a === null) ret = 1; if (a === undefined) ret = 2;
+    if (a === null) ret = 1; if (a === undefined) ret = 2;
+    if (a === null) ret = 1; if (a === undefined) ret = 2;
+    if (a === null) ret = 1; if (a === undefined) ret = 2;
+    if (a === null) ret = 1; if (a === undefined) ret = 2;
+    if (a === null) ret = 1; if (a === undefined) ret = 2;
+    if (a === null) ret = 1; if (a === undefined) ret = 2;
+    if (a === null) ret = 1; if (a === undefined) ret = 2;
+  }
+  return ret;
+}
+
+function strictEqualsBranch(a, b) {
+  var ret = 0;
+  for (var i = 0; i < 1000; ++i) {
+    if (a === b) ret = 1; if (a !== b) ret = 2;
+    if (a === b) ret = 1; if (a !== b) ret = 2;
+    if (a === b) ret = 1; if (a !== b) ret = 2;
+    if (a === b) ret = 1; if (a !== b) ret = 2;
+    if (a === b) ret = 1; if (a !== b) ret = 2;
+    if (a === b) ret = 1; if (a !== b) ret = 2;
+    if (a === b) ret = 1; if (a !== b) ret = 2;
+    if (a === b) ret = 1; if (a !== b) ret = 2;
+    if (a === b) ret = 1; if (a !== b) ret = 2;
+    if (a === b) ret = 1; if (a !== b) ret = 2;
+  }
+  return ret;
+}
+
+function ConstantLoads() {
+  constantLoads();
+}
+
+function RegisterMoves() {
+  registerMoves(10);
+}
+
+function NullChecks() {
+  nullChecks({});
+}
+
+function StrictEqualsBranch() {
+  strictEqualsBranch(10, 20);
+}
@@ -0,0 +1,47 @@
+// Copyright 2024 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+// Payloads shaped like typical API responses: arrays of records with a mix of
+// short keys, long free-text strings, numbers and nested objects.
+function MakeRecord(i, text) {
+  return {
+    id: i,
+    name: 'user' + i,
+    email: 'user' + i + '@example.com',
+    active: i % 3 != 0,
+    score: i * 1.25,
+    tags: ['alpha', 'beta', 'gamma'].slice(0, i % 4),
+    address: {street: i + ' Main Street', city: 'Springfield', zip: '12345'},
+    bio: text,
+  };
+}
+
+const kPlainText = 'Lorem ipsum dolor sit amet, consectetur adipiscing elit, ' +
+    'sed do eiusmod tempor incididunt ut labore et dolore magna aliqua. ';
+const kEscapedText = 'He said \"hello\"\n\tand left.\\ ' + kPlainText;
+
+function MakePayload(count, text) {
+  const records = [];
+  for (let i = 0; i < count; ++i) records.push(MakeRecord(i, text));
+  return JSON.stringify({total: count, records: records});
+}
+
+const kSmallPayload = MakePayload(100, kPlainText);
+const kLargePayload = MakePayload(5000, kPlainText.repeat(8));
+const kEscapedPayload = MakePayload(1000, kEscapedText.repeat(4));
+const kTwoBytePayload = MakePayload(1000, (kPlainText + '☃').repeat(4));
+const kLongStringPayload = JSON.stringify(['x'.repeat(1 << 20)]);
+
+let parsed;
+
+createSuite('ParseSmall', 100, () => { parsed = JSON.parse(kSmallPayload); },
+            () => {});
+createSuite('ParseLarge', 1, () => { parsed = JSON.parse(kLargePayload); },
+            () => {});
+createSuite('ParseEscaped', 10, () => { parsed = JSON.parse(kEscapedPayload); },
+            () => {});
+createSuite('ParseTwoByte', 10, () => { parsed = JSON.parse(kTwoBytePayload); },
+            () => {});
+createSuite('ParseLongString', 10,
+            () => { parsed = JSON.parse(kLongStringPayload); }, () => {});
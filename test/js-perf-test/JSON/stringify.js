@@ -0,0 +1,27 @@
+// Copyright 2024 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+const kText = 'Lorem ipsum dolor sit amet, consectetur adipiscing elit, ' +
+    'sed do eiusmod tempor incididunt ut labore et dolore magna aliqua. ';
+
+function MakeRecords(count, text) {
+  const records = [];
+  for (let i = 0; i < count; ++i) {
+    records.push({id: i, name: 'user' + i, active: i % 2 == 0, bio: text});
+  }
+  return records;
+}
+
+const kShortStrings = MakeRecords(1000, 'hello');
+const kLongStrings = MakeRecords(1000, kText.repeat(16));
+const kEscapedStrings = MakeRecords(1000, ('"quoted"\n' + kText).repeat(4));
+
+let stringified;
+
+createSuite('StringifyShortStrings', 100,
+            () => { stringified = JSON.stringify(kShortStrings); }, () => {});
+createSuite('StringifyLongStrings', 10,
+            () => { stringified = JSON.stringify(kLongStrings); }, () => {});
+createSuite('StringifyEscapedStrings', 10,
+            () => { stringified = JSON.stringify(kEscapedStrings); }, () => {});
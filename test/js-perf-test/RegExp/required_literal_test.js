@@ -0,0 +1,33 @@
+// Copyright 2024 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+// Scanning log lines that mostly do not match: every match contains a
+// literal that most lines lack.
+
+const lines = [];
+for (let i = 0; i < 100; i++) {
+  lines.push(`2024-01-01T00:00:${i % 60} INFO request ${i} served in ${i}ms`);
+}
+lines.push("2024-01-01T00:01:40 ERROR: disk quota exceeded for user42");
+
+const errorRe = /ERROR: (\w+) quota/;
+function RequiredLiteralTest() {
+  let count = 0;
+  for (const line of lines) {
+    if (errorRe.test(line)) count++;
+  }
+  return count;
+}
+
+const emailRe = /\w+@example\.com/g;
+const logText = lines.join("\n");
+function RequiredLiteralMatchTest() {
+  return logText.match(emailRe);
+}
+
+benchmarks = [ [RequiredLiteralTest, () => {}],
+               [RequiredLiteralMatchTest, () => {}],
+             ];
+
+createBenchmarkSuite("RequiredLiteralTest");
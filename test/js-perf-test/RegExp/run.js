@@ -11,6 +11,7 @@ d8.file.execute('flags.js');
 d8.file.execute('inline_test.js')
 d8.file.execute('complex_case_test.js');
 d8.file.execute('case_test.js');
+d8.file.execute('required_literal_test.js');
 d8.file.execute('match.js');
 d8.file.execute('replace.js');
 d8.file.execute('search.js');
@@ -0,0 +1,27 @@
+// Copyright 2024 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+// Strings long enough to be scanned in blocks, with the terminating or escape
+// character at every possible position within a block.
+(function TestStringTerminatorPositions() {
+  for (let length = 0; length < 70; ++length) {
+    const prefix = 'x'.repeat(length);
+    assertEquals(prefix, JSON.parse(`"${prefix}"`));
+    assertEquals(prefix + '"' + prefix, JSON.parse(`"${prefix}\\"${prefix}"`));
+    assertEquals(prefix + '\n', JSON.parse(`"${prefix}\\n"`));
+    assertEquals(prefix + 'ÿ', JSON.parse(`"${prefix}ÿ"`));
+    assertEquals([prefix, 1], JSON.parse(`["${prefix}", 1]`));
+    assertThrows(() => JSON.parse(`"${prefix}\u0001"`), SyntaxError);
+    assertThrows(() => JSON.parse(`"${prefix}\u001f${prefix}"`), SyntaxError);
+    assertThrows(() => JSON.parse(`"${prefix}`), SyntaxError);
+  }
+})();
+
+(function TestNonControlBytesAreNotTerminators() {
+  // Characters that only differ from '"', '\\' or control characters in the
+  // high bit must not end the string.
+  const chars = '¢Ü\u0080\u009f  \u007f';
+  const long = chars.repeat(10);
+  assertEquals(long, JSON.parse(`"${long}"`));
+})();
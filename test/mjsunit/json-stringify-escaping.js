@@ -0,0 +1,30 @@
+// Copyright 2024 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+// Characters that need escaping at every position within a block, in short
+// strings and in strings that are longer than the stringifier's buffer.
+(function TestEscapePositions() {
+  for (const length of [0, 1, 15, 16, 17, 31, 32, 33, 5000, 40000]) {
+    const prefix = 'x'.repeat(length);
+    for (const [c, escaped] of [['"', '\\"'], ['\\', '\\\\'], ['\n', '\\n'],
+                                ['\u0001', '\\u0001'], ['\u001f', '\\u001f']]) {
+      assertEquals(`"${prefix}${escaped}"`, JSON.stringify(prefix + c));
+      assertEquals(`"${escaped}${prefix}${escaped}"`,
+                   JSON.stringify(c + prefix + c));
+      assertEquals(`["${prefix}${escaped}${prefix}"]`,
+                   JSON.stringify([prefix + c + prefix]));
+    }
+  }
+})();
+
+(function TestLongStringManyEscapes() {
+  const s = '"\n'.repeat(30000);
+  assertEquals('"' + '\\"\\n'.repeat(30000) + '"', JSON.stringify(s));
+  assertEquals(s, JSON.parse(JSON.stringify(s)));
+})();
+
+(function TestLatin1IsNotEscaped() {
+  const s = '\u007f\u0080¢ÿ'.repeat(100);
+  assertEquals('"' + s + '"', JSON.stringify(s));
+})();
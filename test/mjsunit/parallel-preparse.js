@@ -0,0 +1,76 @@
+// Copyright 2024 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+// Flags: --parallel-preparse --parallel-preparse-min-source-size=0
+
+function RunScript(source) {
+  return Realm.eval(Realm.current(), source);
+}
+
+// Many top-level functions of all kinds, so that workers get to some of them
+// before the parser does.
+(function TestManyFunctions() {
+  let source = '';
+  for (let i = 0; i < 200; i++) {
+    source += `
+      function plain${i}(a, b = ${i}, ...c) {
+        function inner() { return a + b; }
+        return inner() + c.length;
+      }
+      async function async${i}(x) { return await x + ${i}; }
+      function* generator${i}() { yield ${i}; yield { value: "}" }; }
+      async function* asyncGenerator${i}() { yield ${i}; }
+      function strict${i}() { "use strict"; return this; }
+      var expression${i} = function(a, b) { return a * b + ${i}; };
+    `;
+  }
+  source += `
+    [plain199(1, 2, 3, 4), generator199().next().value, strict199(),
+     expression199(2, 3), plain0.length, expression0.length,
+     asyncGenerator199.constructor.name];
+  `;
+  let result = RunScript(source);
+  assertEquals([5, 199, undefined, 205, 1, 2, 'AsyncGeneratorFunction'],
+               result);
+  RunScript('async199(1)').then(value => assertEquals(200, value));
+})();
+
+// Braces in strings, comments, templates and regexps must not confuse the
+// search for top-level functions.
+(function TestTrickyTokens() {
+  let source = `
+    var s = "{ function notAFunction() {";
+    // function alsoNotAFunction() {
+    /* } function stillNotAFunction() { */
+    var t = \`\${ { a: function inTemplate() { return "}"; } }.a() } }\`;
+    var r = /[}{]function notAFunctionEither(){/.test("}");
+    function f1(x) { return /}/.test(x) ? "\`" : '{'; }
+    function f2() { return t + s; }
+    [f1("}"), f2(), r, f1.length]
+  `;
+  assertEquals(['`', '} }{ function notAFunction() {', false, 1],
+               RunScript(source));
+})();
+
+// A script that starts with "use strict" makes its functions strict.
+(function TestStrictScript() {
+  let source = `
+    'use strict';
+    function f() { return this; }
+    function g() { return function() { return this; }(); }
+    [f(), g()]
+  `;
+  assertEquals([undefined, undefined], RunScript(source));
+})();
+
+// Errors in function bodies are reported as usual.
+(function TestSyntaxError() {
+  let source = 'function ok() { return 1; }\n';
+  for (let i = 0; i < 50; i++) source += `function f${i}() { return ${i}; }\n`;
+  source += 'function bad() { return 1 +; }\n';
+  assertThrows(() => RunScript(source), SyntaxError);
+
+  source = 'function bad() { "use strict"; with ({}) {} }\n' + source;
+  assertThrows(() => RunScript(source), SyntaxError);
+})();
@@ -0,0 +1,45 @@
+// Copyright 2024 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+// Flags: --allow-natives-syntax --default-to-experimental-regexp-engine
+
+// The experimental engine skips over characters that can't start a match of
+// an unanchored regexp.  Check that this doesn't change any results.
+
+function Test(regexp, subject, expectedResult) {
+  assertEquals(%RegexpTypeTag(regexp), "EXPERIMENTAL");
+  assertEquals(expectedResult, regexp.exec(subject));
+}
+
+const filler = "-".repeat(100);
+const twoByteFiller = "ሴ".repeat(100);
+
+for (const prefix of [filler, twoByteFiller]) {
+  // A single start character.
+  Test(/x/, prefix + "x", ["x"]);
+  Test(/xyz/, prefix + "xy" + prefix + "xyz", ["xyz"]);
+  Test(/xyz/, prefix + "xy" + prefix, null);
+  // Several start characters, including two-byte ones.
+  Test(/ab|cd/, prefix + "ac" + prefix + "cd", ["cd"]);
+  Test(/[0-9]+px/, prefix + "12p" + prefix + "345px", ["345px"]);
+  Test(/ስ|y/, prefix + "ስ", ["ስ"]);
+  // Threads of earlier attempts that are blocked at a start instruction.
+  Test(/a+b/, prefix + "aaa" + prefix + "aab", ["aab"]);
+  Test(/(?:ab)*c/, prefix + "abab" + prefix + "ababc", ["ababc"]);
+  // Captures.
+  Test(/(a)(b)?c/, prefix + "ab" + prefix + "ac", ["ac", "a", undefined]);
+  // Patterns that can match the empty string, or start with an assertion,
+  // aren't skipped over.
+  Test(/x*/, prefix + "x", [""]);
+  Test(/\bx/, prefix + "x", ["x"]);
+  Test(/(?<=-)x/, prefix + "x", prefix == filler ? ["x"] : null);
+}
+
+// Global regexps restart the search after every match.
+assertEquals(["ab", "ab", "ab"],
+             (filler + "ab" + filler + "ab" + filler + "ab").match(/ab/g));
+const global = /b+/g;
+global.lastIndex = 3;
+assertEquals(["bb"], global.exec("bbb" + filler + "bb"));
+assertEquals(filler.length + 5, global.lastIndex);
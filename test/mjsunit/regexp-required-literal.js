@@ -0,0 +1,100 @@
+// Copyright 2024 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+// Flags: --regexp-required-literal-prefilter
+
+// Irregexp skips matching when a literal that occurs in every match is
+// missing from the rest of the subject. None of that may change results.
+
+const filler = "abcdefghij".repeat(10);
+
+for (const padding of ["", "ሴ"]) {
+  const prefix = padding + filler;
+
+  // Literal at the end, with and without a match.
+  const email = /\w+@example\.com/;
+  assertEquals(null, email.exec(prefix));
+  assertEquals(null, email.exec(prefix + "user@example.org"));
+  assertEquals(["user@example.com"],
+               email.exec(prefix + " user@example.com"));
+  assertFalse(email.test(prefix + "@example.co"));
+
+  // Literals split by groups, captures and quantifiers.
+  assertEquals(["key=value;", "value"],
+               /key=(\w+);/.exec(prefix + " key=value;"));
+  assertEquals(null, /key=(\w+);/.exec(prefix + " key=value"));
+  assertEquals(["xyzxyz"], /(?:xyz){2}/.exec(prefix + "xyzxyz"));
+  assertEquals(null, /(?:xyz){2}/.exec(prefix + "xyzxy"));
+  assertEquals(["ERROR: disk"], /ERROR: +\w+/.exec(prefix + " ERROR: disk"));
+  assertEquals(null, /ERROR: +\w+/.exec(prefix + " WARN: disk"));
+  assertEquals(["a1bc", "1"], /a(\d)bc/.exec(prefix + "a1bc"));
+
+  // Optional parts and alternatives do not contribute.
+  assertEquals(["xy"], /x(?:zz)?y/.exec(prefix + "xy"));
+  assertEquals(["zz"], /(?:xy)*zz/.exec(prefix + "zz"));
+  assertEquals(["qq"], /qq|rr/.exec(prefix + "qq"));
+  assertEquals(["rr"], /qq|rr/.exec(prefix + "rr"));
+
+  // Lookarounds are not part of the match.
+  assertEquals(["cd"], /(?<=ab)cd/.exec(prefix));
+  assertEquals(["kl"], /kl(?=mn)|kl/.exec(prefix + "kl"));
+
+  // Literals with non-Latin1 characters are not used.
+  assertEquals(["ሴa"], /ሴa/.exec(prefix + "ሴa"));
+
+  // Ignore-case regexps are not affected.
+  assertEquals(["USER@EXAMPLE.COM"],
+               /\w+@example\.com/i.exec(prefix + " USER@EXAMPLE.COM"));
+}
+
+// The literal must occur at or after lastIndex.
+{
+  const re = /foo\d/g;
+  const subject = "foo1 bar foo2 bar";
+  assertEquals(["foo1"], re.exec(subject));
+  assertEquals(4, re.lastIndex);
+  assertEquals(["foo2"], re.exec(subject));
+  assertEquals(13, re.lastIndex);
+  assertEquals(null, re.exec(subject));
+  assertEquals(0, re.lastIndex);
+  assertEquals(["foo1", "foo2"], subject.match(/foo\d/g));
+  assertEquals("X bar X bar", subject.replace(/foo\d/g, "X"));
+}
+
+{
+  const re = /bar/y;
+  re.lastIndex = 5;
+  assertTrue(re.test("foo1 bar"));
+  re.lastIndex = 6;
+  assertFalse(re.test("foo1 bar"));
+}
+
+// Sticky and start-anchored regexps on long subjects, where the literal is
+// far behind the only position that is tried.
+{
+  const long_subject = "foo1" + filler.repeat(100) + "bar2";
+  const sticky = /bar\d/y;
+  assertFalse(sticky.test(long_subject));
+  assertEquals(0, sticky.lastIndex);
+  sticky.lastIndex = long_subject.length - 4;
+  assertEquals(["bar2"], sticky.exec(long_subject));
+  assertEquals(long_subject.length, sticky.lastIndex);
+  const sticky_foo = /foo\d/y;
+  assertEquals(["foo1"], sticky_foo.exec(long_subject));
+  assertEquals(null, sticky_foo.exec(long_subject));
+  assertEquals(null, /^bar\d/.exec(long_subject));
+  assertEquals(["foo1"], /^foo\d/.exec(long_subject));
+  assertEquals(["bar2"], /^bar\d/m.exec(filler + "\nbar2"));
+}
+
+// Cons and sliced strings.
+{
+  let cons = filler;
+  for (let i = 0; i < 10; i++) cons += "x" + i;
+  assertEquals(null, /needle/.exec(cons));
+  assertEquals(["needle"], /needle/.exec(cons + "needle"));
+  const sliced = (filler + "needle" + filler).substring(5);
+  assertEquals(["needle"], /ne+dle/.exec(sliced));
+  assertEquals(null, /ne+dle/.exec(sliced.substring(100)));
+}
@@ -0,0 +1,63 @@
+// Copyright 2024 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+// Long runs of plain ASCII in identifiers, strings, comments and whitespace
+// are scanned in bulk; the characters that end them have to be found at
+// every offset.
+
+(function TestIdentifiers() {
+  for (let length = 1; length < 40; length++) {
+    let name = 'x'.repeat(length);
+    assertEquals(length, eval(`var ${name} = ${length}; ${name}`));
+    assertEquals(length, eval(`var ${name}é = ${length}; ${name}é`));
+    assertEquals(length, eval(`var ${name}\\u0061 = ${length}; ${name}a`));
+  }
+  // Keywords have to be recognized after the bulk copy.
+  assertEquals('function', eval('typeof function() {}'));
+  assertThrows('var instanceof = 1', SyntaxError);
+  assertEquals(1, eval('var instanceofx = 1; instanceofx'));
+  assertEquals(2, eval('var Z_$0123456789 = 2; Z_$0123456789'));
+})();
+
+(function TestStrings() {
+  for (let length = 0; length < 40; length++) {
+    let plain = 'a'.repeat(length);
+    assertEquals(plain + '"', eval(`'${plain}"'`));
+    assertEquals(plain + "'", eval(`"${plain}'"`));
+    assertEquals(plain + '\n', eval(`'${plain}\\n'`));
+    assertEquals(plain + 'ሴ' + plain, eval(`'${plain}ሴ${plain}'`));
+    assertEquals(plain + '~', eval(`'${plain}~'`));
+    assertThrows(`'${plain}\n'`, SyntaxError);
+    assertThrows(`'${plain}`, SyntaxError);
+  }
+  let long = 'abc def '.repeat(10000);
+  assertEquals(long, eval(`'${long}'`));
+  assertEquals(long + 'ÿ', eval(`'${long}ÿ'`));
+  assertEquals(long + 'Ā', eval(`'${long}Ā'`));
+})();
+
+(function TestComments() {
+  for (let length = 0; length < 40; length++) {
+    let plain = 'b'.repeat(length);
+    assertEquals(1, eval(`// ${plain}\n1`));
+    assertEquals(3, eval(`/* ${plain} */ 3`));
+    assertEquals(4, eval(`/* ${plain} **/ 4`));
+    assertEquals(5, eval(`/* ${plain}\n${plain}*/ 5`));
+    assertEquals(6, eval(`/* ${plain}é${plain}*/ 6`));
+    assertThrows(`/* ${plain}`, SyntaxError);
+  }
+  // A multi-line comment with a newline counts as a line terminator.
+  assertEquals(undefined, eval(`(function() { return /* ${'c'.repeat(50)}
+                                 */ 1; })()`));
+})();
+
+(function TestWhiteSpace() {
+  for (let length = 0; length < 40; length++) {
+    let spaces = ' '.repeat(length);
+    assertEquals(7, eval(`${spaces}7${spaces}`));
+    assertEquals(undefined,
+                 eval(`(function() { return${spaces}\n${spaces}8; })()`));
+    assertEquals(9, eval(`${spaces}\t${spaces}9`));
+  }
+})();
@@ -0,0 +1,39 @@
+// Copyright 2024 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+// Short patterns at every position of subjects long enough to be searched in
+// blocks, with near-misses that match the first and the last character only.
+
+function naiveIndexOf(subject, pattern, from) {
+  for (let i = from; i + pattern.length <= subject.length; i++) {
+    if (subject.substr(i, pattern.length) === pattern) return i;
+  }
+  return -1;
+}
+
+function testPatterns(filler, patterns) {
+  for (const pattern of patterns) {
+    const near_miss = pattern[0] + filler.repeat(pattern.length - 2) +
+        pattern[pattern.length - 1];
+    for (let length = 0; length < 70; length++) {
+      for (const position of [0, 1, length >> 1, length - 1, length]) {
+        if (position < 0 || position > length) continue;
+        const prefix = (near_miss + filler).repeat(length).substr(0, position);
+        const subject = prefix + pattern + filler.repeat(length - position);
+        for (const from of [0, 1, 17, position]) {
+          assertEquals(naiveIndexOf(subject, pattern, from),
+                       subject.indexOf(pattern, from));
+        }
+        assertTrue(subject.includes(pattern));
+        assertEquals(subject.split(pattern).join(pattern), subject);
+        assertEquals(subject.replaceAll(pattern, ''),
+                     subject.split(pattern).join(''));
+      }
+    }
+  }
+}
+
+testPatterns('x', ['ab', 'aba', 'a\nb', 'abcde', 'aaaaaa']);
+testPatterns('☃', ['ab', 'a☃b', '☃☄', 'abcĀ']);
+testPatterns('x', ['àá', 'ÿÿÿ']);
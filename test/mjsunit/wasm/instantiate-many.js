@@ -0,0 +1,84 @@
+// Copyright 2024 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+d8.file.execute("test/mjsunit/wasm/wasm-module-builder.js");
+
+(function TestInstantiateSameModuleRepeatedly() {
+  print(arguments.callee.name);
+  const builder = new WasmModuleBuilder();
+  const sig = builder.addType(kSig_i_i);
+  builder.addImport('m', 'f', sig);
+  builder.addImport('m', 'ä', sig);
+  builder.addImportedGlobal('g', '0', kWasmI32);
+  builder.addFunction('call_f', sig)
+      .addBody([kExprLocalGet, 0, kExprCallFunction, 0])
+      .exportFunc();
+  builder.addFunction('call_ä', sig)
+      .addBody([kExprLocalGet, 0, kExprCallFunction, 1])
+      .exportFunc();
+  builder.addFunction('7', kSig_i_v)
+      .addBody([kExprGlobalGet, 0])
+      .exportFunc();
+  const module = builder.toModule();
+
+  for (let i = 0; i < 50; ++i) {
+    const instance = new WebAssembly.Instance(module, {
+      m: {f: x => x + i, 'ä': x => x * i},
+      g: {'0': i}
+    });
+    assertEquals(['7', 'call_f', 'call_ä'],
+                 Object.keys(instance.exports).sort());
+    assertEquals(3 + i, instance.exports.call_f(3));
+    assertEquals(3 * i, instance.exports['call_ä'](3));
+    assertEquals(i, instance.exports[7]());
+  }
+
+  // Missing imports are still reported with the right name.
+  assertThrows(
+      () => new WebAssembly.Instance(module, {m: {f: x => x}, g: {'0': 0}}),
+      WebAssembly.LinkError, /Import #1 module="m" function="ä": function import/);
+})();
+
+(function TestGlobalsOfManyInstances() {
+  print(arguments.callee.name);
+  const builder = new WasmModuleBuilder();
+  const constant = builder.addGlobal(
+      kWasmI32, true,
+      [...wasmI32Const(6), ...wasmI32Const(7), kExprI32Mul]);
+  const wide = builder.addGlobal(kWasmI64, false, wasmI64Const(-5n));
+  const float = builder.addGlobal(kWasmF64, true, wasmF64Const(2.5));
+  builder.addExportOfKind('constant', kExternalGlobal, constant.index);
+  builder.addExportOfKind('wide', kExternalGlobal, wide.index);
+  builder.addExportOfKind('float', kExternalGlobal, float.index);
+  const module = builder.toModule();
+
+  for (let i = 0; i < 10; ++i) {
+    const instance = new WebAssembly.Instance(module);
+    assertEquals(42, instance.exports.constant.value);
+    assertEquals(-5n, instance.exports.wide.value);
+    assertEquals(2.5, instance.exports.float.value);
+    // Each instance has its own globals.
+    instance.exports.constant.value = i;
+    instance.exports.float.value = i;
+  }
+})();
+
+(function TestGlobalsThatDependOnImports() {
+  print(arguments.callee.name);
+  const builder = new WasmModuleBuilder();
+  const imported = builder.addImportedGlobal('m', 'g', kWasmI32, false);
+  const derived = builder.addGlobal(
+      kWasmI32, false,
+      [kExprGlobalGet, imported, ...wasmI32Const(1), kExprI32Add]);
+  const constant = builder.addGlobal(kWasmI32, false, wasmI32Const(17));
+  builder.addExportOfKind('derived', kExternalGlobal, derived.index);
+  builder.addExportOfKind('constant', kExternalGlobal, constant.index);
+  const module = builder.toModule();
+
+  for (let i = 0; i < 10; ++i) {
+    const instance = new WebAssembly.Instance(module, {m: {g: i}});
+    assertEquals(i + 1, instance.exports.derived.value);
+    assertEquals(17, instance.exports.constant.value);
+  }
+})();
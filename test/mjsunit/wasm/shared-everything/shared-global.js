@@ -0,0 +1,53 @@
+// Copyright 2024 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+// Flags: --experimental-wasm-shared
+
+d8.file.execute('test/mjsunit/wasm/wasm-module-builder.js');
+
+(function SharedGlobal() {
+  print(arguments.callee.name);
+  let builder = new WasmModuleBuilder();
+  let global = builder.addGlobal(kWasmI32, true, wasmI32Const(42), true);
+  builder.addFunction('get', kSig_i_v)
+      .addBody([kExprGlobalGet, global.index])
+      .exportFunc();
+  builder.addFunction('set', kSig_v_i)
+      .addBody([kExprLocalGet, 0, kExprGlobalSet, global.index])
+      .exportFunc();
+  let instance = builder.instantiate();
+  assertEquals(42, instance.exports.get());
+  instance.exports.set(7);
+  assertEquals(7, instance.exports.get());
+})();
+
+(function SharedGlobalOfReferenceType() {
+  print(arguments.callee.name);
+  let builder = new WasmModuleBuilder();
+  builder.addGlobal(kWasmExternRef, true, [kExprRefNull, kExternRefCode],
+                    true);
+  assertThrows(() => builder.instantiate(), WebAssembly.CompileError,
+               /shared global of non-shared type externref/);
+})();
+
+(function ImportedImmutableSharedGlobal() {
+  print(arguments.callee.name);
+  let builder = new WasmModuleBuilder();
+  let global = builder.addImportedGlobal('m', 'g', kWasmI64, false, true);
+  builder.addFunction('get', kSig_l_v)
+      .addBody([kExprGlobalGet, global])
+      .exportFunc();
+  let instance = builder.instantiate({m: {g: 12n}});
+  assertEquals(12n, instance.exports.get());
+})();
+
+(function ImportedMutableSharedGlobal() {
+  print(arguments.callee.name);
+  let builder = new WasmModuleBuilder();
+  builder.addImportedGlobal('m', 'g', kWasmI32, true, true);
+  let global = new WebAssembly.Global({value: 'i32', mutable: true}, 0);
+  assertThrows(
+      () => builder.instantiate({m: {g: global}}), WebAssembly.LinkError,
+      /mutable shared globals cannot be imported/);
+})();
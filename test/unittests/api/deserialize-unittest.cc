@@ -360,6 +360,30 @@ class MergeDeserializedCodeTest : public DeserializeTest {
     array->set(kLazySfi, WeakOrSmi(lazy));
   }
 
+  // Checks that compiled code of {script} can only create closures for
+  // SharedFunctionInfos which are registered on {script}.
+  static void CheckClosuresUseRegisteredSfis(i::Tagged<i::Script> script,
+                                             i::Isolate* i_isolate) {
+    i::DisallowGarbageCollection no_gc;
+    i::Tagged<i::WeakFixedArray> sfis = script->shared_function_infos();
+    for (int index = 0; index < sfis->length(); ++index) {
+      i::Tagged<i::HeapObject> heap_object;
+      if (!sfis->get(index).GetHeapObjectIfWeak(&heap_object)) continue;
+      i::Tagged<i::SharedFunctionInfo> sfi =
+          i::SharedFunctionInfo::cast(heap_object);
+      if (!sfi->HasBytecodeArray()) continue;
+      i::Tagged<i::FixedArray> constant_pool =
+          sfi->GetBytecodeArray(i_isolate)->constant_pool();
+      for (int entry = 0; entry < constant_pool->length(); ++entry) {
+        i::Tagged<i::Object> inner = constant_pool->get(entry);
+        if (!i::IsSharedFunctionInfo(inner)) continue;
+        int literal_id =
+            i::SharedFunctionInfo::cast(inner)->function_literal_id();
+        CHECK_EQ(sfis->get(literal_id), WeakOrSmi(inner));
+      }
+    }
+  }
+
   void AgeBytecodeAndGC(ScriptObjectFlag sfis_to_age,
                         i::Handle<i::WeakFixedArray> original_objects,
                         i::Isolate* i_isolate) {
@@ -413,7 +437,9 @@ class MergeDeserializedCodeTest : public DeserializeTest {
                           ScriptObjectFlag retained_after_background_merge,
                           ScriptObjectFlag aged_after_background_merge,
                           bool lazy_should_be_compiled = false,
-                          bool eager_should_be_compiled = true) {
+                          bool eager_should_be_compiled = true,
+                          bool continue_merge_on_main_thread = false,
+                          bool run_code_between_merge_steps = false) {
     i::v8_flags.merge_background_deserialized_script_with_compilation_cache =
         true;
     std::unique_ptr<v8::ScriptCompiler::CachedData> cached_data;
@@ -448,7 +474,7 @@ class MergeDeserializedCodeTest : public DeserializeTest {
       cached_data.reset(
           ScriptCompiler::CreateCodeCache(script->GetUnboundScript()));
 
-      if (run_code_after_background_merge) {
+      if (run_code_after_background_merge || run_code_between_merge_steps) {
         // We must retain the v8::Script (a JSFunction) so we can run it later.
         original_script = handle_scope.Escape(script);
         // It doesn't make any sense to configure a test case which says it
@@ -504,6 +530,30 @@ class MergeDeserializedCodeTest : public DeserializeTest {
 
     AgeBytecodeAndGC(aged_after_background_merge, original_objects, i_isolate);
 
+    if (continue_merge_on_main_thread) {
+      // Without a time budget, every call does a single step of the merge.
+      auto check_original_script = [&]() {
+        i::Tagged<i::HeapObject> script;
+        if (original_objects->get(kScript).GetHeapObjectIfWeak(&script)) {
+          CheckClosuresUseRegisteredSfis(i::Script::cast(script), i_isolate);
+        }
+      };
+      bool done;
+      do {
+        done = task->ContinueMergeOnMainThread(isolate(), 0);
+        CHECK(merge_expected || done);
+        check_original_script();
+        // Once the original top-level code is available again, run it, which
+        // creates closures while the merge is still in progress.
+        if (run_code_between_merge_steps &&
+            GetSharedFunctionInfo(original_script)->is_compiled()) {
+          CHECK(!original_script->Run(context()).IsEmpty());
+          CHECK_EQ(RunGlobalFunc("lazy"), v8::Integer::New(isolate(), 42));
+          check_original_script();
+        }
+      } while (!done);
+    }
+
     ScriptCompiler::Source source(NewString(kSourceCode), default_origin,
                                   cached_data.release(), task.release());
     Local<Script> script =
@@ -607,6 +657,19 @@ TEST_F(MergeDeserializedCodeTest, MergeBasicWithLateFlushing) {
                      false);            // eager_should_be_compiled
 }
 
+TEST_F(MergeDeserializedCodeTest, MergeBasicOnMainThreadInSteps) {
+  // Like MergeBasic, but the main-thread part of the merge is done in steps
+  // before compiling.
+  TestOffThreadMerge(kEagerAndLazy,     // retained_before_background_merge
+                     kToplevelSfiFlag,  // aged_before_background_merge
+                     false,             // run_code_after_background_merge
+                     kNone,             // retained_after_background_merge
+                     kNone,             // aged_after_background_merge
+                     false,             // lazy_should_be_compiled
+                     true,              // eager_should_be_compiled
+                     true);             // continue_merge_on_main_thread
+}
+
 TEST_F(MergeDeserializedCodeTest, RunScriptButNoReMergeNecessary) {
   // The original script is run after the background merge, causing the
   // top-level SFI and lazy SFI to become compiled. However, no SFIs are
@@ -631,6 +694,36 @@ TEST_F(MergeDeserializedCodeTest, MainThreadReMerge) {
                      true);                  // lazy_should_be_compiled
 }
 
+TEST_F(MergeDeserializedCodeTest, MainThreadReMergeInSteps) {
+  // Like MainThreadReMerge, but the main-thread part of the merge is done in
+  // steps before compiling, after the IIFE SFI has been recreated.
+  TestOffThreadMerge(kToplevelEagerAndLazy,  // retained_before_background_merge
+                     kToplevelAndEager,      // aged_before_background_merge
+                     true,                   // run_code_after_background_merge
+                     kAllScriptObjects,      // retained_after_background_merge
+                     kToplevelSfiFlag,       // aged_after_background_merge
+                     true,                   // lazy_should_be_compiled
+                     true,                   // eager_should_be_compiled
+                     true);                  // continue_merge_on_main_thread
+}
+
+TEST_F(MergeDeserializedCodeTest, RunCodeBetweenMergeStepsOnMainThread) {
+  // The top-level and eager SFIs are flushed and the IIFE SFI disappears, so
+  // the main thread has to copy the deserialized bytecode to the original
+  // SFIs and add the new IIFE SFI to the original script. The original script
+  // is run between the steps of that, as soon as its top-level code is
+  // available.
+  TestOffThreadMerge(kToplevelEagerAndLazy,  // retained_before_background_merge
+                     kToplevelAndEager,      // aged_before_background_merge
+                     false,                  // run_code_after_background_merge
+                     kAllScriptObjects,      // retained_after_background_merge
+                     kNone,                  // aged_after_background_merge
+                     true,                   // lazy_should_be_compiled
+                     true,                   // eager_should_be_compiled
+                     true,                   // continue_merge_on_main_thread
+                     true);                  // run_code_between_merge_steps
+}
+
 TEST_F(MergeDeserializedCodeTest, Regress1360024) {
   // This test case triggers a re-merge on the main thread, similar to
   // MainThreadReMerge. However, it does not retain the lazy function's SFI at
@@ -0,0 +1,144 @@
+// Copyright 2024 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#include "src/codegen/compile-hints.h"
+
+#include <memory>
+#include <string>
+
+#include "src/execution/isolate.h"
+#include "src/handles/handles-inl.h"
+#include "src/heap/factory.h"
+#include "src/parsing/scanner-character-streams.h"
+#include "src/parsing/scanner.h"
+#include "test/unittests/test-utils.h"
+#include "testing/gtest/include/gtest/gtest.h"
+
+namespace v8 {
+namespace internal {
+
+using CompileHintsTest = TestWithIsolate;
+
+TEST_F(CompileHintsTest, SerializeRoundTrip) {
+  CompileHints hints;
+  hints.Add(1, 300);
+  hints.Add(1, 10);
+  hints.Add(1, 100000);
+  hints.Add(1, 10);
+  hints.Add(0xFFFFFFFF, 0);
+
+  std::vector<uint8_t> data = hints.Serialize();
+  std::unique_ptr<CompileHints> copy =
+      CompileHints::Deserialize(base::VectorOf(data));
+  ASSERT_NE(nullptr, copy);
+
+  const CompileHints::Positions* positions = copy->Lookup(1);
+  ASSERT_NE(nullptr, positions);
+  EXPECT_EQ((CompileHints::Positions{10, 300, 100000}), *positions);
+  positions = copy->Lookup(0xFFFFFFFF);
+  ASSERT_NE(nullptr, positions);
+  EXPECT_EQ((CompileHints::Positions{0}), *positions);
+  EXPECT_EQ(nullptr, copy->Lookup(2));
+
+  void* callback_data =
+      const_cast<CompileHints::Positions*>(copy->Lookup(1));
+  EXPECT_TRUE(CompileHints::ShouldEagerCompile(300, callback_data));
+  EXPECT_FALSE(CompileHints::ShouldEagerCompile(301, callback_data));
+}
+
+TEST_F(CompileHintsTest, RejectInvalidData) {
+  CompileHints hints;
+  hints.Add(7, 1000);
+  std::vector<uint8_t> data = hints.Serialize();
+
+  EXPECT_EQ(nullptr, CompileHints::Deserialize({}));
+  for (size_t length = 0; length < data.size(); length++) {
+    EXPECT_EQ(nullptr,
+              CompileHints::Deserialize(base::VectorOf(data.data(), length)));
+  }
+  std::vector<uint8_t> trailing = data;
+  trailing.push_back(0);
+  EXPECT_EQ(nullptr, CompileHints::Deserialize(base::VectorOf(trailing)));
+  std::vector<uint8_t> bad_magic = data;
+  bad_magic[0] ^= 1;
+  EXPECT_EQ(nullptr, CompileHints::Deserialize(base::VectorOf(bad_magic)));
+}
+
+TEST_F(CompileHintsTest, DeserializeMergesDuplicateScripts) {
+  auto uint32 = [](uint32_t value) {
+    return std::vector<uint8_t>{
+        static_cast<uint8_t>(value), static_cast<uint8_t>(value >> 8),
+        static_cast<uint8_t>(value >> 16), static_cast<uint8_t>(value >> 24)};
+  };
+  std::vector<uint8_t> data;
+  for (uint32_t value : {0xC0DE4854u, 1u, 2u, 5u, 2u}) {
+    std::vector<uint8_t> bytes = uint32(value);
+    data.insert(data.end(), bytes.begin(), bytes.end());
+  }
+  // Positions 10 and 15.
+  data.push_back(10);
+  data.push_back(5);
+  for (uint32_t value : {5u, 2u}) {
+    std::vector<uint8_t> bytes = uint32(value);
+    data.insert(data.end(), bytes.begin(), bytes.end());
+  }
+  // Positions 12 and 15.
+  data.push_back(12);
+  data.push_back(3);
+
+  std::unique_ptr<CompileHints> hints =
+      CompileHints::Deserialize(base::VectorOf(data));
+  ASSERT_NE(nullptr, hints);
+  const CompileHints::Positions* positions = hints->Lookup(5);
+  ASSERT_NE(nullptr, positions);
+  EXPECT_EQ((CompileHints::Positions{10, 12, 15}), *positions);
+}
+
+TEST_F(CompileHintsTest, AddHints) {
+  CompileHints hints;
+  hints.Add(1, 20);
+  CompileHints other;
+  other.Add(1, 10);
+  other.Add(1, 20);
+  other.Add(2, 30);
+  hints.Add(other);
+
+  std::vector<uint8_t> data = hints.Serialize();
+  std::unique_ptr<CompileHints> copy =
+      CompileHints::Deserialize(base::VectorOf(data));
+  ASSERT_NE(nullptr, copy);
+  EXPECT_EQ((CompileHints::Positions{10, 20}), *copy->Lookup(1));
+  EXPECT_EQ((CompileHints::Positions{30}), *copy->Lookup(2));
+  // Equal hints give equal files.
+  EXPECT_EQ(data, copy->Serialize());
+}
+
+TEST_F(CompileHintsTest, FingerprintStreamMatchesString) {
+  std::string source = "function f() { return 1; }\n";
+  while (source.size() < 40 * KB) source += source;
+  std::unique_ptr<Utf16CharacterStream> stream =
+      ScannerStream::ForTesting(source.c_str(), source.size());
+  Handle<String> string =
+      i_isolate()
+          ->factory()
+          ->NewStringFromOneByte(base::OneByteVector(source.c_str()))
+          .ToHandleChecked();
+
+  uint32_t fingerprint = CompileHints::Fingerprint(stream.get());
+  EXPECT_EQ(0u, stream->pos());
+  EXPECT_EQ(fingerprint, CompileHints::Fingerprint(i_isolate(), string));
+
+  // Only the beginning of the source counts.
+  source.back() = ' ';
+  std::unique_ptr<Utf16CharacterStream> changed_end =
+      ScannerStream::ForTesting(source.c_str(), source.size());
+  EXPECT_EQ(fingerprint, CompileHints::Fingerprint(changed_end.get()));
+  source.front() = ' ';
+  std::unique_ptr<Utf16CharacterStream> changed_start =
+      ScannerStream::ForTesting(source.c_str(), source.size());
+  EXPECT_NE(fingerprint, CompileHints::Fingerprint(changed_start.get()));
+}
+
+}  // namespace internal
+}  // namespace v8
@@ -21,6 +21,7 @@
 #include "src/parsing/parsing.h"
 #include "src/parsing/scanner-character-streams.h"
 #include "src/zone/zone-list-inl.h"
+#include "test/common/flag-utils.h"
 #include "test/unittests/test-helpers.h"
 #include "test/unittests/test-utils.h"
 #include "testing/gtest/include/gtest/gtest.h"
@@ -846,5 +847,53 @@ TEST_F(LazyCompileDispatcherTest, CompileMultipleOnBackgroundThread) {
   dispatcher.AbortAll();
 }
 
+TEST_F(LazyCompileDispatcherTest, BackgroundJobsRunInEnqueueOrder) {
+  FlagScope<unsigned int> max_threads(
+      &v8_flags.lazy_compile_dispatcher_max_threads, 1);
+  MockPlatform platform;
+  LazyCompileDispatcher dispatcher(i_isolate(), &platform, v8_flags.stack_size);
+
+  Handle<SharedFunctionInfo> shared_1 =
+      test::CreateSharedFunctionInfo(i_isolate(), nullptr);
+  Handle<SharedFunctionInfo> shared_2 =
+      test::CreateSharedFunctionInfo(i_isolate(), nullptr);
+  EnqueueUnoptimizedCompileJob(&dispatcher, i_isolate(), shared_1);
+  EnqueueUnoptimizedCompileJob(&dispatcher, i_isolate(), shared_2);
+  ASSERT_EQ(dispatcher.pending_background_jobs_.size(), 2u);
+
+  // Have dispatcher block on the background thread when running the first
+  // job.
+  {
+    base::LockGuard<base::Mutex> lock(&dispatcher.mutex_);
+    dispatcher.block_for_testing_.SetValue(true);
+  }
+  platform.RunJobTasks(V8::GetCurrentPlatform());
+  while (dispatcher.block_for_testing_.Value()) {
+  }
+
+  // The job that was enqueued first is running.
+  ASSERT_EQ(
+      dispatcher.GetJobFor(shared_1, base::MutexGuard(&dispatcher.mutex_))
+          ->state,
+      LazyCompileDispatcher::Job::State::kRunning);
+  ASSERT_EQ(
+      dispatcher.GetJobFor(shared_2, base::MutexGuard(&dispatcher.mutex_))
+          ->state,
+      LazyCompileDispatcher::Job::State::kPending);
+
+  {
+    base::LockGuard<base::Mutex> lock(&dispatcher.mutex_);
+    dispatcher.semaphore_for_testing_.Signal();
+  }
+  platform.BlockUntilComplete();
+  ASSERT_EQ(dispatcher.pending_background_jobs_.size(), 0u);
+  ASSERT_EQ(dispatcher.finalizable_jobs_.size(), 2u);
+
+  platform.RunIdleTask(1000.0, 0.0);
+  ASSERT_TRUE(shared_1->is_compiled());
+  ASSERT_TRUE(shared_2->is_compiled());
+  dispatcher.AbortAll();
+}
+
 }  // namespace internal
 }  // namespace v8
@@ -1757,6 +1757,111 @@ TEST_F(InterpreterTest, InterpreterSmiComparisons) {
   }
 }
 
+TEST_F(InterpreterTest, InterpreterComparisonsFollowedByJumps) {
+  // Comparison handlers do a following JumpIfTrue or JumpIfFalse themselves.
+  int inputs[] = {-42, 0, 1, 42};
+
+  for (size_t c = 0; c < arraysize(kComparisonTypes); c++) {
+    Token::Value comparison = kComparisonTypes[c];
+    for (bool jump_if_true : {true, false}) {
+      for (size_t i = 0; i < arraysize(inputs); i++) {
+        for (size_t j = 0; j < arraysize(inputs); j++) {
+          FeedbackVectorSpec feedback_spec(zone());
+          BytecodeArrayBuilder builder(zone(), 1, 1, &feedback_spec);
+
+          FeedbackSlot slot = feedback_spec.AddCompareICSlot();
+          Handle<i::FeedbackMetadata> metadata =
+              FeedbackMetadata::New(i_isolate(), &feedback_spec);
+
+          Register r0(0);
+          BytecodeLabel jumped;
+          builder.LoadLiteral(Smi::FromInt(inputs[i]))
+              .StoreAccumulatorInRegister(r0)
+              .LoadLiteral(Smi::FromInt(inputs[j]))
+              .CompareOperation(comparison, r0, GetIndex(slot));
+          if (jump_if_true) {
+            builder.JumpIfTrue(ToBooleanMode::kAlreadyBoolean, &jumped);
+          } else {
+            builder.JumpIfFalse(ToBooleanMode::kAlreadyBoolean, &jumped);
+          }
+          builder.LoadLiteral(Smi::FromInt(1))
+              .Return()
+              .Bind(&jumped)
+              .LoadLiteral(Smi::FromInt(2))
+              .Return();
+
+          Handle<BytecodeArray> bytecode_array =
+              builder.ToBytecodeArray(i_isolate());
+          InterpreterTester tester(i_isolate(), bytecode_array, metadata);
+          auto callable = tester.GetCallable<>();
+          Handle<Object> return_value = callable().ToHandleChecked();
+          bool should_jump =
+              CompareC(comparison, inputs[i], inputs[j]) == jump_if_true;
+          CHECK_EQ(Smi::ToInt(*return_value), should_jump ? 2 : 1);
+        }
+      }
+    }
+  }
+}
+
+TEST_F(InterpreterTest, InterpreterTestsFollowedByJumps) {
+  // Like comparisons, the Test* bytecodes do a following JumpIfTrue or
+  // JumpIfFalse themselves. With v8_enable_ignition_dispatch_prefetch, they
+  // also load the handler of the next bytecode on entry, which must not be
+  // used when the inlined jump is not taken.
+  enum class TestKind { kNull, kUndefined, kUndetectable, kReferenceEqual };
+  for (TestKind kind : {TestKind::kNull, TestKind::kUndefined,
+                        TestKind::kUndetectable, TestKind::kReferenceEqual}) {
+    for (bool value_is_nil : {true, false}) {
+      for (bool jump_if_true : {true, false}) {
+        BytecodeArrayBuilder builder(zone(), 1, 1);
+
+        Register r0(0);
+        BytecodeLabel jumped;
+        if (kind == TestKind::kUndefined) {
+          builder.LoadUndefined();
+        } else {
+          builder.LoadNull();
+        }
+        builder.StoreAccumulatorInRegister(r0);
+        if (!value_is_nil) builder.LoadLiteral(Smi::FromInt(0));
+        switch (kind) {
+          case TestKind::kNull:
+            builder.CompareNull();
+            break;
+          case TestKind::kUndefined:
+            builder.CompareUndefined();
+            break;
+          case TestKind::kUndetectable:
+            builder.CompareUndetectable();
+            break;
+          case TestKind::kReferenceEqual:
+            builder.CompareReference(r0);
+            break;
+        }
+        if (jump_if_true) {
+          builder.JumpIfTrue(ToBooleanMode::kAlreadyBoolean, &jumped);
+        } else {
+          builder.JumpIfFalse(ToBooleanMode::kAlreadyBoolean, &jumped);
+        }
+        builder.LoadLiteral(Smi::FromInt(1))
+            .Return()
+            .Bind(&jumped)
+            .LoadLiteral(Smi::FromInt(2))
+            .Return();
+
+        Handle<BytecodeArray> bytecode_array =
+            builder.ToBytecodeArray(i_isolate());
+        InterpreterTester tester(i_isolate(), bytecode_array);
+        auto callable = tester.GetCallable<>();
+        Handle<Object> return_value = callable().ToHandleChecked();
+        bool should_jump = value_is_nil == jump_if_true;
+        CHECK_EQ(Smi::ToInt(*return_value), should_jump ? 2 : 1);
+      }
+    }
+  }
+}
+
 TEST_F(InterpreterTest, InterpreterHeapNumberComparisons) {
   double inputs[] = {std::numeric_limits<double>::min(),
                      std::numeric_limits<double>::max(),
@@ -0,0 +1,82 @@
+// Copyright 2024 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#include "src/strings/mapped-file-string-resource.h"
+
+#include <string>
+
+#include "include/v8-isolate.h"
+#include "include/v8-primitive.h"
+#include "src/base/platform/platform.h"
+#include "test/unittests/test-utils.h"
+#include "testing/gtest/include/gtest/gtest.h"
+
+namespace v8 {
+namespace internal {
+
+class MappedFileStringResourceTest : public TestWithContext {
+ protected:
+  // Writes {contents} to a file that is removed at the end of the test.
+  const char* WriteFile(const std::string& contents) {
+    path_ = "mapped-file-string-resource-unittest-" +
+            std::to_string(base::OS::GetCurrentProcessId()) + ".js";
+    FILE* file = base::OS::FOpen(path_.c_str(), "wb");
+    CHECK_NOT_NULL(file);
+    CHECK_EQ(contents.size(),
+             fwrite(contents.data(), 1, contents.size(), file));
+    fclose(file);
+    return path_.c_str();
+  }
+
+  void TearDown() override {
+    if (!path_.empty()) base::OS::Remove(path_.c_str());
+  }
+
+ private:
+  std::string path_;
+};
+
+TEST_F(MappedFileStringResourceTest, AsciiFileIsMapped) {
+  std::string contents;
+  while (contents.size() < 64 * KB) {
+    contents += "function f" + std::to_string(contents.size()) + "() {}\n";
+  }
+  contents += "function g() { return 42; }\ng()";
+  Local<v8::String> source =
+      v8::String::NewFromFile(isolate(), WriteFile(contents))
+          .ToLocalChecked();
+  EXPECT_TRUE(source->IsExternalOneByte());
+  EXPECT_EQ(static_cast<int>(contents.size()), source->Length());
+  EXPECT_EQ(42, RunJS(source)->Int32Value(context()).FromJust());
+
+  // The source is still there after its pages are dropped.
+  isolate()->MemoryPressureNotification(MemoryPressureLevel::kCritical);
+  MappedFileStringResource::DiscardAllResidentPages();
+  EXPECT_EQ(42, RunJS("g()")->Int32Value(context()).FromJust());
+  v8::String::Utf8Value function_source(isolate(), RunJS("g.toString()"));
+  EXPECT_STREQ("function g() { return 42; }", *function_source);
+}
+
+TEST_F(MappedFileStringResourceTest, Utf8FileIsDecoded) {
+  Local<v8::String> source =
+      v8::String::NewFromFile(isolate(),
+                              WriteFile("'\xC3\xA4'.charCodeAt(0)"))
+          .ToLocalChecked();
+  EXPECT_FALSE(source->IsExternalOneByte());
+  EXPECT_EQ(0xE4, RunJS(source)->Int32Value(context()).FromJust());
+}
+
+TEST_F(MappedFileStringResourceTest, EmptyFile) {
+  Local<v8::String> source =
+      v8::String::NewFromFile(isolate(), WriteFile("")).ToLocalChecked();
+  EXPECT_EQ(0, source->Length());
+}
+
+TEST_F(MappedFileStringResourceTest, MissingFile) {
+  EXPECT_TRUE(
+      v8::String::NewFromFile(isolate(), "does/not/exist.js").IsEmpty());
+}
+
+}  // namespace internal
+}  // namespace v8
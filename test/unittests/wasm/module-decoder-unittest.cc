@@ -645,6 +645,37 @@ TEST_F(WasmModuleVerifyTest, GlobalInitializer) {
   }
 }
 
+TEST_F(WasmModuleVerifyTest, SharedGlobal) {
+  static const uint8_t data[] = {
+      SECTION(Global,                     // --
+              ENTRY_COUNT(1),             // --
+              kI32Code,                   // local type
+              0b11,                       // shared, mutable
+              WASM_INIT_EXPR_I32V_1(13))  // init
+  };
+  EXPECT_FAILURE_WITH_MSG(data, "invalid global flags 0x3");
+
+  WASM_FEATURE_SCOPE(shared);
+  ModuleResult result = DecodeModule(base::ArrayVector(data));
+  EXPECT_OK(result);
+  const WasmGlobal* global = &result.value()->globals.back();
+  EXPECT_EQ(kWasmI32, global->type);
+  EXPECT_TRUE(global->mutability);
+  EXPECT_TRUE(global->shared);
+}
+
+TEST_F(WasmModuleVerifyTest, SharedGlobalInvalidType) {
+  WASM_FEATURE_SCOPE(shared);
+  static const uint8_t data[] = {
+      SECTION(Global,                          // --
+              ENTRY_COUNT(1),                  // --
+              kExternRefCode,                  // local type
+              0b10,                            // shared, immutable
+              WASM_INIT_EXPR_EXTERN_REF_NULL)  // init
+  };
+  EXPECT_FAILURE_WITH_MSG(data, "shared global of non-shared type externref");
+}
+
 TEST_F(WasmModuleVerifyTest, ZeroGlobals) {
   static const uint8_t data[] = {SECTION(Global, ENTRY_COUNT(0))};
   ModuleResult result = DecodeModule(base::ArrayVector(data));
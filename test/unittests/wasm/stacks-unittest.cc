@@ -0,0 +1,61 @@
+// Copyright 2024 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#include "src/wasm/stacks.h"
+
+#include "test/common/flag-utils.h"
+#include "test/unittests/test-utils.h"
+#include "testing/gtest/include/gtest/gtest.h"
+
+namespace v8::internal::wasm {
+namespace stacks_unittest {
+
+class StackPoolTest : public TestWithIsolate {
+ public:
+  size_t segment_size() const {
+    return GetPlatformPageAllocator()->AllocatePageSize();
+  }
+};
+
+TEST_F(StackPoolTest, ReusesFreedSegment) {
+  StackPool pool(i_isolate()->counters());
+  base::Vector<uint8_t> first = pool.Allocate(segment_size());
+  EXPECT_EQ(segment_size(), pool.allocated_size());
+  EXPECT_EQ(0u, pool.pooled_size());
+
+  pool.Free(first);
+  EXPECT_EQ(segment_size(), pool.allocated_size());
+  EXPECT_EQ(segment_size(), pool.pooled_size());
+
+  EXPECT_EQ(0u, pool.reused_count());
+  base::Vector<uint8_t> second = pool.Allocate(segment_size());
+  EXPECT_EQ(first.begin(), second.begin());
+  EXPECT_EQ(1u, pool.reused_count());
+  EXPECT_EQ(segment_size(), pool.allocated_size());
+  EXPECT_EQ(0u, pool.pooled_size());
+  pool.Free(second);
+}
+
+TEST_F(StackPoolTest, DoesNotReuseOtherSizes) {
+  StackPool pool(i_isolate()->counters());
+  base::Vector<uint8_t> small = pool.Allocate(segment_size());
+  pool.Free(small);
+  base::Vector<uint8_t> large = pool.Allocate(2 * segment_size());
+  EXPECT_EQ(2 * segment_size(), large.size());
+  EXPECT_EQ(3 * segment_size(), pool.allocated_size());
+  EXPECT_EQ(segment_size(), pool.pooled_size());
+  pool.Free(large);
+}
+
+TEST_F(StackPoolTest, FreesWhenFull) {
+  FlagScope<int> pool_size(&v8_flags.wasm_stack_pool_size, 0);
+  StackPool pool(i_isolate()->counters());
+  base::Vector<uint8_t> segment = pool.Allocate(segment_size());
+  pool.Free(segment);
+  EXPECT_EQ(0u, pool.allocated_size());
+  EXPECT_EQ(0u, pool.pooled_size());
+}
+
+}  // namespace stacks_unittest
+}  // namespace v8::internal::wasm